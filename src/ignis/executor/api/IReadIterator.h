@@ -3,6 +3,7 @@
 #define IGNIS_IREADITERATOR_H
 
 #include "ignis/executor/core/exception/ILogicError.h"
+#include <cstdint>
 #include <memory>
 
 namespace ignis {
@@ -19,6 +20,13 @@ namespace ignis {
                 virtual std::shared_ptr<Tp> nextShared() { throw core::exception::ILogicError("not implemented"); }
 
                 virtual bool hasNext() { throw core::exception::ILogicError("not implemented"); }
+
+                /*Reads up to n elements into out, returns the number of elements read*/
+                virtual int64_t readBatch(Tp *out, int64_t n) {
+                    int64_t i = 0;
+                    for (; i < n && hasNext(); i++) { out[i] = next(); }
+                    return i;
+                }
             };
         }// namespace api
     }    // namespace executor
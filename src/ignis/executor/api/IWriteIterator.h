@@ -3,6 +3,7 @@
 #define IGNIS_IWRITEITERATOR_H
 
 #include "ignis/executor/core/exception/ILogicError.h"
+#include <cstdint>
 
 namespace ignis {
     namespace executor {
@@ -16,6 +17,11 @@ namespace ignis {
                 virtual void write(Tp &obj) { throw core::exception::ILogicError("not implemented"); }
 
                 virtual void write(Tp &&obj) { throw core::exception::ILogicError("not implemented"); }
+
+                /*Writes a copy of the n elements of in*/
+                virtual void writeBatch(Tp *in, int64_t n) {
+                    for (int64_t i = 0; i < n; i++) { write(in[i]); }
+                }
             };
         }// namespace api
     }    // namespace executor
@@ -60,17 +60,34 @@ void IExecutorData::enableMpiCores() {
 }
 
 std::vector<MPI::Intracomm> IExecutorData::duplicate(const MPI::Intracomm &comm, int64_t threads) {
-    std::vector<MPI::Intracomm> result;
-    result.push_back(comm);
-    if (threads == 1) { return result; };
-    result.back().Set_name("ignis_thread_0");
-    IGNIS_LOG(info) << "Duplicating mpi group for " << threads << " threads";
-    for (int64_t i = 1; i < threads; i++) {
-        result.push_back(result.back().Dup());
-        result.back().Set_name(("ignis_thread_" + std::to_string(i)).c_str());
+    if (threads == 1) { return std::vector<MPI::Intracomm>(1, comm); };
+    /*Dup is collective, every executor calls duplicate in the same order so all pools grow together*/
+    auto &pool = duplicates[comm];
+    if (pool.empty()) {
+        pool.push_back(comm);
+        pool.back().Set_name("ignis_thread_0");
+    }
+    if (pool.size() < threads) {
+        IGNIS_LOG(info) << "Duplicating mpi group for " << threads << " threads";
+    }
+    for (int64_t i = pool.size(); i < threads; i++) {
+        pool.push_back(pool.back().Dup());
+        pool.back().Set_name(("ignis_thread_" + std::to_string(i)).c_str());
         IGNIS_LOG(info) << "mpi group " << i << " ready";
     }
-    return result;
+    return std::vector<MPI::Intracomm>(pool.begin(), pool.begin() + threads);
+}
+
+void IExecutorData::releaseMpiGroup(const MPI::Intracomm &comm) {
+    auto entry = duplicates.find(comm);
+    if (entry != duplicates.end()) {
+        for (int64_t i = 1; i < entry->second.size(); i++) {
+            _mpi.clearMsgOpt(entry->second[i]);
+            entry->second[i].Free();
+        }
+        duplicates.erase(entry);
+    }
+    _mpi.clearMsgOpt(comm);
 }
 
 void IExecutorData::setMpiGroup(const MPI::Intracomm &group) {
@@ -79,9 +96,10 @@ void IExecutorData::setMpiGroup(const MPI::Intracomm &group) {
 }
 
 void IExecutorData::destroyMpiGroup() {
-    for (auto comm : context.mpi_thread_group) {
-        if (comm != MPI::COMM_WORLD) { comm.Free(); }
-    }
+    /*Thread groups are duplicates of the first one and belong to its pool*/
+    auto group = context.mpi_thread_group[0];
+    releaseMpiGroup(group);
+    if (group != MPI::COMM_WORLD) { group.Free(); }
     setMpiGroup(MPI::COMM_WORLD);
 }
 
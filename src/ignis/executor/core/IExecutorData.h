@@ -96,8 +96,12 @@ namespace ignis {
 
                 void enableMpiCores();
 
+                /*Duplicates are pooled and reused until the group is released*/
                 std::vector<MPI::Intracomm> duplicate(const MPI::Intracomm& comm, int64_t threads);
 
+                /*Frees the pooled duplicates and cached handshakes of a group, the group itself is not freed*/
+                void releaseMpiGroup(const MPI::Intracomm &comm);
+
                 void setMpiGroup(const MPI::Intracomm &group);
 
                 void destroyMpiGroup();
@@ -116,6 +120,7 @@ namespace ignis {
                 IPartitionTools partition_tools;
                 IMpi _mpi;
                 api::IContext context;
+                std::map<MPI_Comm, std::vector<MPI::Intracomm>> duplicates;
             };
         }// namespace core
     }    // namespace executor
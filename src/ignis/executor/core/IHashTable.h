@@ -0,0 +1,126 @@
+
+#ifndef IGNIS_IHASHTABLE_H
+#define IGNIS_IHASHTABLE_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ignis {
+    namespace executor {
+        namespace core {
+
+            /*Open addressing table with robin hood probing, elements are stored inline without a node per key*/
+            template<typename Key, typename Elem, typename KeyOf, typename Hash = std::hash<Key>,
+                     typename Equal = std::equal_to<Key>>
+            class IHashTable {
+            public:
+                class iterator {
+                public:
+                    iterator(IHashTable *table, size_t pos);
+
+                    Elem &operator*() const { return table->slots[pos]; }
+
+                    Elem *operator->() const { return &table->slots[pos]; }
+
+                    iterator &operator++();
+
+                    bool operator==(const iterator &other) const { return pos == other.pos; }
+
+                    bool operator!=(const iterator &other) const { return pos != other.pos; }
+
+                private:
+                    friend class IHashTable;
+                    IHashTable *table;
+                    size_t pos;
+                };
+
+                IHashTable();
+
+                IHashTable(const IHashTable &) = delete;
+
+                IHashTable &operator=(const IHashTable &) = delete;
+
+                virtual ~IHashTable();
+
+                iterator begin() { return iterator(this, 0); }
+
+                iterator end() { return iterator(this, capacity()); }
+
+                iterator find(const Key &key);
+
+                std::pair<iterator, bool> insert(Elem &&elem);
+
+                std::pair<iterator, bool> insert(const Elem &elem);
+
+                /*Same as insert, the hint is ignored*/
+                iterator insert(iterator hint, Elem &&elem) { return insert(std::move(elem)).first; }
+
+                /*Backward shift deletion, iterators are invalidated*/
+                void erase(iterator it);
+
+                size_t erase(const Key &key);
+
+                size_t size() const { return count; }
+
+                bool empty() const { return count == 0; }
+
+                size_t capacity() const { return dist.size(); }
+
+                void reserve(size_t n);
+
+                /*Destroys the elements but keeps the allocated slots for the next use*/
+                void clear();
+
+            protected:
+                /*Position of the element or the slot where the search stopped*/
+                size_t search(const Key &key, size_t hash, bool &found) const;
+
+                size_t home(size_t hash) const { return (size_t) ((uint64_t) hash * 0x9E3779B97F4A7C15ull >> shift); }
+
+                size_t place(Elem &&elem, size_t pos, uint32_t d);
+
+                void rehash(size_t new_capacity);
+
+                std::vector<uint32_t> dist;//probe distance + 1, 0 means empty
+                Elem *slots;
+                size_t count;
+                int shift;
+                std::allocator<Elem> allocator;
+                KeyOf keyOf;
+                Hash hasher;
+                Equal equal;
+            };
+
+            template<typename Key, typename Value>
+            struct IHashMapKey {
+                const Key &operator()(const std::pair<Key, Value> &elem) const { return elem.first; }
+            };
+
+            template<typename Key>
+            struct IHashSetKey {
+                const Key &operator()(const Key &elem) const { return elem; }
+            };
+
+            template<typename Key, typename Value, typename Hash = std::hash<Key>,
+                     typename Equal = std::equal_to<Key>>
+            class IHashMap
+                : public IHashTable<Key, std::pair<Key, Value>, IHashMapKey<Key, Value>, Hash, Equal> {
+            public:
+                Value &operator[](const Key &key);
+
+                Value &operator[](Key &&key);
+            };
+
+            template<typename Key, typename Hash = std::hash<Key>, typename Equal = std::equal_to<Key>>
+            class IHashSet : public IHashTable<Key, Key, IHashSetKey<Key>, Hash, Equal> {};
+
+        }// namespace core
+    }    // namespace executor
+}// namespace ignis
+
+#include "IHashTable.tcc"
+
+#endif
@@ -0,0 +1,176 @@
+
+#include "IHashTable.h"
+
+#define IHashTableClass ignis::executor::core::IHashTable
+#define IHashMapClass ignis::executor::core::IHashMap
+
+template<typename Key, typename Elem, typename KeyOf, typename Hash, typename Equal>
+IHashTableClass<Key, Elem, KeyOf, Hash, Equal>::iterator::iterator(IHashTable *table, size_t pos)
+    : table(table), pos(pos) {
+    while (this->pos < table->capacity() && table->dist[this->pos] == 0) { this->pos++; }
+}
+
+template<typename Key, typename Elem, typename KeyOf, typename Hash, typename Equal>
+typename IHashTableClass<Key, Elem, KeyOf, Hash, Equal>::iterator &
+IHashTableClass<Key, Elem, KeyOf, Hash, Equal>::iterator::operator++() {
+    do { pos++; } while (pos < table->capacity() && table->dist[pos] == 0);
+    return *this;
+}
+
+template<typename Key, typename Elem, typename KeyOf, typename Hash, typename Equal>
+IHashTableClass<Key, Elem, KeyOf, Hash, Equal>::IHashTable() : slots(nullptr), count(0), shift(64) {}
+
+template<typename Key, typename Elem, typename KeyOf, typename Hash, typename Equal>
+IHashTableClass<Key, Elem, KeyOf, Hash, Equal>::~IHashTable() {
+    clear();
+    if (slots) { allocator.deallocate(slots, capacity()); }
+}
+
+template<typename Key, typename Elem, typename KeyOf, typename Hash, typename Equal>
+typename IHashTableClass<Key, Elem, KeyOf, Hash, Equal>::iterator
+IHashTableClass<Key, Elem, KeyOf, Hash, Equal>::find(const Key &key) {
+    bool found;
+    size_t pos = search(key, hasher(key), found);
+    return found ? iterator(this, pos) : end();
+}
+
+template<typename Key, typename Elem, typename KeyOf, typename Hash, typename Equal>
+std::pair<typename IHashTableClass<Key, Elem, KeyOf, Hash, Equal>::iterator, bool>
+IHashTableClass<Key, Elem, KeyOf, Hash, Equal>::insert(Elem &&elem) {
+    size_t hash = hasher(keyOf(elem));
+    bool found;
+    size_t pos = search(keyOf(elem), hash, found);
+    if (found) { return std::make_pair(iterator(this, pos), false); }
+    /*Max load 7/8*/
+    if ((count + 1) * 8 > capacity() * 7) {
+        rehash(std::max(capacity() * 2, (size_t) 16));
+        pos = search(keyOf(elem), hash, found);
+    }
+    uint32_t d = (uint32_t) (((pos - home(hash)) & (capacity() - 1)) + 1);
+    pos = place(std::move(elem), pos, d);
+    count++;
+    return std::make_pair(iterator(this, pos), true);
+}
+
+template<typename Key, typename Elem, typename KeyOf, typename Hash, typename Equal>
+std::pair<typename IHashTableClass<Key, Elem, KeyOf, Hash, Equal>::iterator, bool>
+IHashTableClass<Key, Elem, KeyOf, Hash, Equal>::insert(const Elem &elem) {
+    auto it = find(keyOf(elem));
+    if (it != end()) { return std::make_pair(it, false); }
+    return insert(Elem(elem));
+}
+
+template<typename Key, typename Elem, typename KeyOf, typename Hash, typename Equal>
+void IHashTableClass<Key, Elem, KeyOf, Hash, Equal>::erase(iterator it) {
+    size_t mask = capacity() - 1;
+    size_t pos = it.pos;
+    size_t next = (pos + 1) & mask;
+    allocator.destroy(&slots[pos]);
+    dist[pos] = 0;
+    /*Pull back the following elements until one is empty or at its home*/
+    while (dist[next] > 1) {
+        allocator.construct(&slots[pos], std::move(slots[next]));
+        allocator.destroy(&slots[next]);
+        dist[pos] = dist[next] - 1;
+        dist[next] = 0;
+        pos = next;
+        next = (next + 1) & mask;
+    }
+    count--;
+}
+
+template<typename Key, typename Elem, typename KeyOf, typename Hash, typename Equal>
+size_t IHashTableClass<Key, Elem, KeyOf, Hash, Equal>::erase(const Key &key) {
+    auto it = find(key);
+    if (it == end()) { return 0; }
+    erase(it);
+    return 1;
+}
+
+template<typename Key, typename Elem, typename KeyOf, typename Hash, typename Equal>
+void IHashTableClass<Key, Elem, KeyOf, Hash, Equal>::reserve(size_t n) {
+    size_t new_capacity = 16;
+    while (new_capacity * 7 < n * 8) { new_capacity *= 2; }
+    if (new_capacity > capacity()) { rehash(new_capacity); }
+}
+
+template<typename Key, typename Elem, typename KeyOf, typename Hash, typename Equal>
+void IHashTableClass<Key, Elem, KeyOf, Hash, Equal>::clear() {
+    if (count == 0) { return; }
+    for (size_t i = 0; i < capacity(); i++) {
+        if (dist[i] != 0) {
+            allocator.destroy(&slots[i]);
+            dist[i] = 0;
+        }
+    }
+    count = 0;
+}
+
+template<typename Key, typename Elem, typename KeyOf, typename Hash, typename Equal>
+size_t IHashTableClass<Key, Elem, KeyOf, Hash, Equal>::search(const Key &key, size_t hash, bool &found) const {
+    found = false;
+    if (capacity() == 0) { return 0; }
+    size_t mask = capacity() - 1;
+    size_t pos = home(hash);
+    /*A resident closer to its home than us means the key is not in the table*/
+    for (uint32_t d = 1; dist[pos] >= d; d++) {
+        if (dist[pos] == d && equal(keyOf(slots[pos]), key)) {
+            found = true;
+            break;
+        }
+        pos = (pos + 1) & mask;
+    }
+    return pos;
+}
+
+template<typename Key, typename Elem, typename KeyOf, typename Hash, typename Equal>
+size_t IHashTableClass<Key, Elem, KeyOf, Hash, Equal>::place(Elem &&elem, size_t pos, uint32_t d) {
+    size_t mask = capacity() - 1;
+    size_t result = capacity();
+    while (dist[pos] != 0) {
+        if (dist[pos] < d) {
+            std::swap(slots[pos], elem);
+            std::swap(dist[pos], d);
+            if (result == capacity()) { result = pos; }
+        }
+        pos = (pos + 1) & mask;
+        d++;
+    }
+    allocator.construct(&slots[pos], std::move(elem));
+    dist[pos] = d;
+    return result == capacity() ? pos : result;
+}
+
+template<typename Key, typename Elem, typename KeyOf, typename Hash, typename Equal>
+void IHashTableClass<Key, Elem, KeyOf, Hash, Equal>::rehash(size_t new_capacity) {
+    std::vector<uint32_t> old_dist(new_capacity, 0);
+    std::swap(dist, old_dist);
+    Elem *old_slots = slots;
+    slots = allocator.allocate(new_capacity);
+    shift = 64;
+    for (size_t c = new_capacity; c > 1; c >>= 1) { shift--; }
+    for (size_t i = 0; i < old_dist.size(); i++) {
+        if (old_dist[i] != 0) {
+            place(std::move(old_slots[i]), home(hasher(keyOf(old_slots[i]))), 1);
+            allocator.destroy(&old_slots[i]);
+        }
+    }
+    if (old_slots) { allocator.deallocate(old_slots, old_dist.size()); }
+}
+
+template<typename Key, typename Value, typename Hash, typename Equal>
+Value &IHashMapClass<Key, Value, Hash, Equal>::operator[](const Key &key) {
+    auto it = this->find(key);
+    if (it != this->end()) { return it->second; }
+    return this->insert(std::pair<Key, Value>(key, Value())).first->second;
+}
+
+template<typename Key, typename Value, typename Hash, typename Equal>
+Value &IHashMapClass<Key, Value, Hash, Equal>::operator[](Key &&key) {
+    auto it = this->find(key);
+    if (it != this->end()) { return it->second; }
+    return this->insert(std::pair<Key, Value>(std::move(key), Value())).first->second;
+}
+
+#undef IHashTableClass
+#undef IHashMapClass
@@ -0,0 +1,46 @@
+
+#include "IHyperLogLog.h"
+#include "exception/IInvalidArgument.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace ignis::executor::core;
+
+IHyperLogLog::IHyperLogLog(int bits) : bits(bits) {
+    if (bits < 4 || bits > 18) { throw exception::IInvalidArgument("hyperloglog bits must be in [4, 18]"); }
+    registers.resize(1 << bits, 0);
+}
+
+void IHyperLogLog::add(uint64_t hash) {
+    /*std::hash may be the identity, mix the bits before using them*/
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ull;
+    hash ^= hash >> 33;
+    size_t index = hash >> (64 - bits);
+    uint64_t rest = (hash << bits) | (1ull << (bits - 1));
+    uint8_t rank = __builtin_clzll(rest) + 1;
+    registers[index] = std::max(registers[index], rank);
+}
+
+void IHyperLogLog::merge(const IHyperLogLog &other) {
+    if (bits != other.bits) { throw exception::IInvalidArgument("hyperloglog bits mismatch"); }
+    for (size_t i = 0; i < registers.size(); i++) { registers[i] = std::max(registers[i], other.registers[i]); }
+}
+
+int64_t IHyperLogLog::estimate() const {
+    double m = registers.size();
+    double sum = 0;
+    int64_t zeros = 0;
+    for (auto r : registers) {
+        sum += std::ldexp(1.0, -r);
+        if (r == 0) { zeros++; }
+    }
+    double e = 0.7213 / (1 + 1.079 / m) * m * m / sum;
+    /*Small range correction*/
+    if (e <= 2.5 * m && zeros > 0) { e = m * std::log(m / zeros); }
+    return (int64_t) std::llround(e);
+}
+
+IHyperLogLog::~IHyperLogLog() {}
@@ -0,0 +1,32 @@
+
+#ifndef IGNIS_IHYPERLOGLOG_H
+#define IGNIS_IHYPERLOGLOG_H
+
+#include <cstdint>
+#include <vector>
+
+namespace ignis {
+    namespace executor {
+        namespace core {
+            /*Cardinality estimation with 2^bits registers, the standard error is 1.04/sqrt(2^bits)*/
+            class IHyperLogLog {
+            public:
+                IHyperLogLog(int bits = 12);
+
+                void add(uint64_t hash);
+
+                void merge(const IHyperLogLog &other);
+
+                int64_t estimate() const;
+
+                virtual ~IHyperLogLog();
+
+            private:
+                int bits;
+                std::vector<uint8_t> registers;
+            };
+        }// namespace core
+    }    // namespace executor
+}// namespace ignis
+
+#endif
@@ -1,9 +1,25 @@
 
 #include "IMpi.h"
+#include "transport/ICodec.h"
+#include "transport/IZlibTransport.h"
+#include <algorithm>
 #include <cstring>
+#include <limits>
+#include <random>
+#include <sys/uio.h>
+#include <unistd.h>
 
 using namespace ignis::executor::core;
 
+namespace {
+    /*Bytes compressed to estimate the ratio and speed of a codec*/
+    const int64_t SAMPLE_BLOCK = 256 * 1024;
+    /*Messages sent on a link before its compression is sampled again*/
+    const int64_t SAMPLE_PERIOD = 16;
+    /*Ratio from which the data is considered incompressible*/
+    const double MIN_RATIO = 0.9;
+}// namespace
+
 IMpi::IMpi(IPropertyParser &properties, IPartitionTools &partition_tools, api::IContext& context)
     : properties(properties), partition_tools(partition_tools), context(context) {}
 
@@ -21,17 +37,25 @@ std::vector<int> IMpi::displs(const std::vector<int> &sz) {
     return std::move(d);
 }
 
+std::vector<int64_t> IMpi::displs(const std::vector<int64_t> &sz) {
+    std::vector<int64_t> d;//Last value is the total size
+    d.reserve(sz.size() + 1);
+    d.push_back(0);
+    for (int i = 0; i < sz.size(); i++) { d.push_back(sz[i] + d[i]); }
+    return std::move(d);
+}
+
 const MPI::Intracomm &IMpi::native() { return context.mpiGroup(); }
 
-std::vector<int> IMpi::szVector(const std::vector<std::pair<int, int>> &elems_szv) {
-    std::vector<int> szv;
+std::vector<int64_t> IMpi::szVector(const std::vector<std::pair<int64_t, int64_t>> &elems_szv) {
+    std::vector<int64_t> szv;
     szv.reserve(elems_szv.size());
     for (int i = 0; i < elems_szv.size(); i++) { szv.push_back(elems_szv[i].second); }
     return std::move(szv);
 }
 
-int IMpi::sumElems(const std::vector<std::pair<int, int>> &elems_szv) {
-    int n = 0;
+int64_t IMpi::sumElems(const std::vector<std::pair<int64_t, int64_t>> &elems_szv) {
+    int64_t n = 0;
     for (int i = 0; i < elems_szv.size(); i++) { n += elems_szv[i].first; }
     return n;
 }
@@ -42,6 +66,297 @@ void IMpi::move(void *begin, size_t n, size_t displ) {
 
 void IMpi::barrier() { native().Barrier(); }
 
+int64_t IMpi::chunkSize() {
+    int64_t chunk = properties.transportChunk();
+    int64_t limit = std::numeric_limits<int>::max();
+    return chunk > 0 && chunk < limit ? chunk : limit;
+}
+
+void IMpi::sendBytes(const MPI::Intracomm &group, const void *buf, int64_t n, int dest, int tag) {
+    int64_t chunk = chunkSize();
+    auto ptr = reinterpret_cast<const uint8_t *>(buf);
+    for (int64_t pos = 0; pos < n; pos += chunk) {
+        group.Send(ptr + pos, (int) std::min(chunk, n - pos), MPI::BYTE, dest, tag);
+    }
+}
+
+void IMpi::recvBytes(const MPI::Intracomm &group, void *buf, int64_t n, int source, int tag) {
+    int64_t chunk = chunkSize();
+    auto ptr = reinterpret_cast<uint8_t *>(buf);
+    for (int64_t pos = 0; pos < n; pos += chunk) {
+        group.Recv(ptr + pos, (int) std::min(chunk, n - pos), MPI::BYTE, source, tag);
+    }
+}
+
+void IMpi::sendShared(const MPI::Intracomm &group, const void *buf, int64_t n, int dest, int tag) {
+    if (!useShared(group, n, dest)) {
+        sendBytes(group, buf, n, dest, tag);
+        return;
+    }
+    /*Node names and pids are not unique across containers, the receiver reads the nonce back from this process
+     * before trusting the pid*/
+    std::random_device random;
+    int64_t nonce = ((int64_t) random() << 32) ^ (int64_t) random();
+    int64_t header[] = {nodeId(), (int64_t) getpid(), (int64_t) buf, (int64_t) &nonce, nonce};
+    bool done;
+    group.Send(header, 5, MPI::LONG, dest, tag);
+    group.Recv(&done, 1, MPI::BOOL, dest, tag);
+    if (!done) {
+        remotePeer(group, dest);
+        sendBytes(group, buf, n, dest, tag);
+    }
+}
+
+void IMpi::recvShared(const MPI::Intracomm &group, void *buf, int64_t n, int source, int tag) {
+    if (!useShared(group, n, source)) {
+        recvBytes(group, buf, n, source, tag);
+        return;
+    }
+    int64_t header[5];
+    int64_t nonce = 0;
+    bool done = false;
+    group.Recv(header, 5, MPI::LONG, source, tag);
+    if (header[0] == nodeId() && readProcess(header[1], header[3], &nonce, sizeof(nonce)) && nonce == header[4]) {
+        done = readProcess(header[1], header[2], buf, n);
+    }
+    group.Send(&done, 1, MPI::BOOL, source, tag);
+    if (!done) {
+        IGNIS_LOG(warning) << "IMpi: executor " << source << " memory is not reachable, using messages";
+        remotePeer(group, source);
+        recvBytes(group, buf, n, source, tag);
+    }
+}
+
+bool IMpi::useShared(const MPI::Intracomm &group, int64_t n, int other) {
+    int64_t min = properties.transportShared();
+    if (min <= 0 || n < min || other == group.Get_rank()) { return false; }
+    bool remote;
+#pragma omp critical(ignis_msg_opt)
+    { remote = remote_peers.count(std::make_pair((MPI_Comm) group, other)) > 0; }
+    return !remote;
+}
+
+void IMpi::remotePeer(const MPI::Intracomm &group, int other) {
+#pragma omp critical(ignis_msg_opt)
+    { remote_peers.insert(std::make_pair((MPI_Comm) group, other)); }
+}
+
+bool IMpi::readProcess(int64_t pid, int64_t addr, void *buf, int64_t n) {
+    auto ptr = reinterpret_cast<uint8_t *>(buf);
+    int64_t pos = 0;
+    while (pos < n) {
+        struct iovec local = {ptr + pos, (size_t) (n - pos)};
+        struct iovec remote = {reinterpret_cast<uint8_t *>(addr) + pos, (size_t) (n - pos)};
+        auto bytes = process_vm_readv((pid_t) pid, &local, 1, &remote, 1, 0);
+        if (bytes <= 0) { return false; }
+        pos += bytes;
+    }
+    return true;
+}
+
+int64_t IMpi::nodeId() {
+    static int64_t id = []() {
+        char name[MPI_MAX_PROCESSOR_NAME];
+        int len;
+        MPI::Get_processor_name(name, len);
+        return (int64_t) std::hash<std::string>()(std::string(name, len));
+    }();
+    return id;
+}
+
+int64_t IMpi::adaptMsg(const MPI::Intracomm &group, std::shared_ptr<transport::IMemoryBuffer> &buffer, int peer) {
+    int64_t sz = buffer->writeEnd();
+    buffer->resetBuffer();
+    /*The first byte is the compression of the serialized data*/
+    auto data = buffer->getWritePtr(sz);
+    int8_t cmp = linkCompression(group, data + 1, sz - 1, peer);
+    if (cmp == 0) { return sz; }
+    auto out = std::make_shared<transport::IMemoryBuffer>();
+    auto zlib = std::make_shared<transport::IZlibTransport>(out, cmp);
+    int64_t chunk = chunkSize();
+    for (int64_t pos = 1; pos < sz; pos += chunk) { zlib->write(data + pos, (uint32_t) std::min(chunk, sz - pos)); }
+    zlib->flush();
+    buffer = out;
+    sz = buffer->writeEnd();
+    buffer->resetBuffer();
+    return sz;
+}
+
+int8_t IMpi::linkCompression(const MPI::Intracomm &group, const uint8_t *data, int64_t n, int peer) {
+    int8_t cmp = properties.msgCompression();
+    if (cmp == 0 || n < properties.transportAdaptive()) { return 0; }
+    auto key = std::make_pair((MPI_Comm) group, peer);
+    LinkStats link = {cmp, 0, 0};
+#pragma omp critical(ignis_msg_opt)
+    {
+        auto it = links.find(key);
+        if (it != links.end()) { link = it->second; }
+        links[key].msgs = link.msgs + 1;
+    }
+    if (link.msgs % SAMPLE_PERIOD != 0) { return link.compression; }
+
+    /*Compression pays when the wire time saved is larger than the time spent compressing, the speed of a link is
+     * unknown until a message is sent on it, then only the ratio is considered*/
+    auto worth = [&link](double ratio, double speed) {
+        return ratio < MIN_RATIO && (link.speed <= 0 || speed * (1 - ratio) > link.speed);
+    };
+    int64_t sample = std::min(n, SAMPLE_BLOCK);
+    double speed;
+    int8_t choice = cmp;
+    if (!worth(sampleCompression(cmp, data, sample, speed), speed)) {
+        choice = transport::ICodec::compression(transport::ICodec::LZ4, 1);
+        if (choice == cmp || !worth(sampleCompression(choice, data, sample, speed), speed)) { choice = 0; }
+    }
+#pragma omp critical(ignis_msg_opt)
+    { links[key].compression = choice; }
+    return choice;
+}
+
+double IMpi::sampleCompression(int8_t compression, const uint8_t *data, int64_t n, double &speed) {
+    auto out = std::make_shared<transport::IMemoryBuffer>(n);
+    auto zlib = std::make_shared<transport::IZlibTransport>(out, compression);
+    double start = MPI::Wtime();
+    zlib->write(data, (uint32_t) n);
+    zlib->flush();
+    double seconds = MPI::Wtime() - start;
+    speed = seconds > 0 ? n / seconds : std::numeric_limits<double>::max();
+    return (double) out->writeEnd() / n;
+}
+
+void IMpi::linkSpeed(const MPI::Intracomm &group, int peer, int64_t n, double seconds) {
+    int64_t min = properties.transportAdaptive();
+    if (min <= 0 || n < min || seconds <= 0) { return; }
+    /*A blocking send also waits for the receiver, the fastest transfer is the best estimate of the link*/
+#pragma omp critical(ignis_msg_opt)
+    {
+        auto it = links.find(std::make_pair((MPI_Comm) group, peer));
+        if (it != links.end()) { it->second.speed = std::max(it->second.speed, n / seconds); }
+    }
+}
+void IMpi::bcastBytes(const MPI::Intracomm &group, void *buf, int64_t n, int root) {
+    int64_t chunk = chunkSize();
+    auto ptr = reinterpret_cast<uint8_t *>(buf);
+    for (int64_t pos = 0; pos < n; pos += chunk) {
+        group.Bcast(ptr + pos, (int) std::min(chunk, n - pos), MPI::BYTE, root);
+    }
+}
+
+void IMpi::gathervBytes(const MPI::Intracomm &group, const void *send, void *rcv, const std::vector<int64_t> &szv,
+                        int root) {
+    int rank = group.Get_rank();
+    int executors = group.Get_size();
+    auto d = displs(szv);
+    int64_t max = *std::max_element(szv.begin(), szv.end());
+    std::vector<int> counts(executors), offsets(executors);
+    if (max <= chunkSize() && d.back() <= std::numeric_limits<int>::max()) {
+        if (rank == root) {
+            for (int i = 0; i < executors; i++) {
+                counts[i] = (int) szv[i];
+                offsets[i] = (int) d[i];
+            }
+            group.Gatherv(MPI::IN_PLACE, 0, MPI::BYTE, rcv, &counts[0], &offsets[0], MPI::BYTE, root);
+        } else {
+            group.Gatherv(send, (int) szv[rank], MPI::BYTE, nullptr, nullptr, nullptr, MPI::BYTE, root);
+        }
+        return;
+    }
+    /*Each round moves one chunk of every rank through a staging buffer, so counts and offsets fit in int*/
+    int64_t chunk = std::min(chunkSize(), (int64_t) std::numeric_limits<int>::max() / executors);
+    int64_t rounds = (max + chunk - 1) / chunk;
+    std::vector<uint8_t> stage(rank == root ? chunk * executors : 0);
+    for (int64_t r = 0; r < rounds; r++) {
+        int64_t pos = r * chunk;
+        for (int i = 0; i < executors; i++) {
+            counts[i] = (int) std::max<int64_t>(0, std::min(chunk, szv[i] - pos));
+            offsets[i] = (int) (i * chunk);
+        }
+        if (rank == root) {
+            group.Gatherv(MPI::IN_PLACE, 0, MPI::BYTE, &stage[0], &counts[0], &offsets[0], MPI::BYTE, root);
+            for (int i = 0; i < executors; i++) {
+                if (i == root) { continue; }
+                std::memcpy((uint8_t *) rcv + d[i] + pos, &stage[offsets[i]], counts[i]);
+            }
+        } else {
+            group.Gatherv((const uint8_t *) send + pos, counts[rank], MPI::BYTE, nullptr, nullptr, nullptr,
+                          MPI::BYTE, root);
+        }
+    }
+}
+
+void IMpi::allgathervBytes(const MPI::Intracomm &group, const void *send, void *rcv,
+                           const std::vector<int64_t> &szv) {
+    int rank = group.Get_rank();
+    int executors = group.Get_size();
+    auto d = displs(szv);
+    int64_t max = *std::max_element(szv.begin(), szv.end());
+    std::vector<int> counts(executors), offsets(executors);
+    if (max <= chunkSize() && d.back() <= std::numeric_limits<int>::max()) {
+        for (int i = 0; i < executors; i++) {
+            counts[i] = (int) szv[i];
+            offsets[i] = (int) d[i];
+        }
+        group.Allgatherv(send, counts[rank], MPI::BYTE, rcv, &counts[0], &offsets[0], MPI::BYTE);
+        return;
+    }
+    /*Same rounds as gathervBytes, every rank keeps a staging buffer*/
+    int64_t chunk = std::min(chunkSize(), (int64_t) std::numeric_limits<int>::max() / executors);
+    int64_t rounds = (max + chunk - 1) / chunk;
+    std::vector<uint8_t> stage(chunk * executors);
+    for (int64_t r = 0; r < rounds; r++) {
+        int64_t pos = r * chunk;
+        for (int i = 0; i < executors; i++) {
+            counts[i] = (int) std::max<int64_t>(0, std::min(chunk, szv[i] - pos));
+            offsets[i] = (int) (i * chunk);
+        }
+        group.Allgatherv((const uint8_t *) send + pos, counts[rank], MPI::BYTE, &stage[0], &counts[0], &offsets[0],
+                         MPI::BYTE);
+        for (int i = 0; i < executors; i++) {
+            std::memcpy((uint8_t *) rcv + d[i] + pos, &stage[offsets[i]], counts[i]);
+        }
+    }
+}
+
+void IMpi::scattervBytes(const MPI::Intracomm &group, const void *send, void *rcv, const std::vector<int64_t> &szv,
+                         int root) {
+    int rank = group.Get_rank();
+    int executors = group.Get_size();
+    auto d = displs(szv);
+    int64_t max = *std::max_element(szv.begin(), szv.end());
+    std::vector<int> counts(executors), offsets(executors);
+    if (max <= chunkSize() && d.back() <= std::numeric_limits<int>::max()) {
+        if (rank == root) {
+            for (int i = 0; i < executors; i++) {
+                counts[i] = (int) szv[i];
+                offsets[i] = (int) d[i];
+            }
+            group.Scatterv(send, &counts[0], &offsets[0], MPI::BYTE, MPI::IN_PLACE, 0, MPI::BYTE, root);
+        } else {
+            group.Scatterv(nullptr, nullptr, nullptr, MPI::BYTE, rcv, (int) szv[rank], MPI::BYTE, root);
+        }
+        return;
+    }
+    int64_t chunk = std::min(chunkSize(), (int64_t) std::numeric_limits<int>::max() / executors);
+    int64_t rounds = (max + chunk - 1) / chunk;
+    std::vector<uint8_t> stage(rank == root ? chunk * executors : 0);
+    for (int64_t r = 0; r < rounds; r++) {
+        int64_t pos = r * chunk;
+        for (int i = 0; i < executors; i++) {
+            counts[i] = (int) std::max<int64_t>(0, std::min(chunk, szv[i] - pos));
+            offsets[i] = (int) (i * chunk);
+        }
+        if (rank == root) {
+            for (int i = 0; i < executors; i++) {
+                if (i == root) { continue; }
+                std::memcpy(&stage[offsets[i]], (const uint8_t *) send + d[i] + pos, counts[i]);
+            }
+            group.Scatterv(&stage[0], &counts[0], &offsets[0], MPI::BYTE, MPI::IN_PLACE, 0, MPI::BYTE, root);
+        } else {
+            group.Scatterv(nullptr, nullptr, nullptr, MPI::BYTE, (uint8_t *) rcv + pos, counts[rank], MPI::BYTE,
+                           root);
+        }
+    }
+}
+
 void IMpi::driverScatterVoid(const MPI::Intracomm &group,
                              storage::IPartitionGroup<storage::IVoidPartition::VOID_TYPE> &part_group,
                              int64_t partitions) {
@@ -51,9 +366,8 @@ void IMpi::driverScatterVoid(const MPI::Intracomm &group,
     bool same_protocol;
     int64_t sz = 0;
     uint8_t *src;
-    std::vector<int> partsv;
-    std::vector<int> szv;
-    std::vector<int> displs;
+    std::vector<int64_t> partsv;
+    std::vector<int64_t> szv;
     auto buffer = std::make_shared<transport::IMemoryBuffer>();
 
     int8_t protocol;
@@ -67,14 +381,17 @@ void IMpi::driverScatterVoid(const MPI::Intracomm &group,
     auto execs_parts = partitions / execs;
     if (partitions % execs > 0) { execs_parts++; }
 
-    partsv.resize(execs_parts, 0);
+    partsv.resize(execs_parts * (execs + 1), 0);
 
-    group.Scatter(&partsv[0], execs_parts, MPI::INT, &partsv[0], execs_parts, MPI::INT, 0);
+    group.Bcast(&partsv[0], partsv.size(), MPI::LONG, 0);
+    szv.resize(execs + 1, 0);
+    for (int64_t i = 0; i < partsv.size(); i++) { szv[i / execs_parts] += partsv[i]; }
+    partsv = std::vector<int64_t>(partsv.begin() + id * execs_parts, partsv.begin() + (id + 1) * execs_parts);
 
-    for (auto &len : partsv) { sz += len; }
+    sz = szv[id];
     src = buffer->getWritePtr(sz);
 
-    group.Scatterv(src, &szv[0], &displs[0], MPI::BYTE, src, sz, MPI::BYTE, 0);
+    scattervBytes(group, nullptr, src, szv, 0);
 
     int64_t offset = 0;
     for (auto &len : partsv) {
@@ -93,6 +410,22 @@ IMpi::MsgOpt IMpi::getMsgOpt(const MPI::Intracomm &group, const std::string &pty
     int dest = send ? other : id;
     MsgOpt opt;
 
+    /*Only peers that completed a handshake with the cpp protocol are cached, so the first handshake keeps the
+     * wire format of the other languages. Both sides must agree to skip it, a side whose storage changed forces it*/
+    auto key = std::make_tuple((MPI_Comm) group, other, send);
+    bool known, cached, other_cached;
+#pragma omp critical(ignis_msg_opt)
+    {
+        auto it = msg_opts.find(key);
+        known = it != msg_opts.end();
+        cached = known && it->second.first == ptype;
+        if (cached) { opt = it->second.second; }
+    }
+    if (known) {
+        group.Sendrecv(&cached, 1, MPI::BOOL, other, tag, &other_cached, 1, MPI::BOOL, other, tag);
+        if (cached && other_cached) { return opt; }
+    }
+
     if (id == source) {
         int8_t protocol = core::protocol::IObjectProtocol::CPP_PROTOCOL;
         std::string storage = ptype;
@@ -115,9 +448,40 @@ IMpi::MsgOpt IMpi::getMsgOpt(const MPI::Intracomm &group, const std::string &pty
         opt.same_storage = ptype == storage;
         group.Send(&opt.same_storage, 1, MPI::BOOL, source, tag);
     }
+    if (opt.same_protocol) {
+#pragma omp critical(ignis_msg_opt)
+        { msg_opts[key] = std::make_pair(ptype, opt); }
+    }
     return opt;
 }
 
+void IMpi::clearMsgOpt(const MPI::Comm &group) {
+#pragma omp critical(ignis_msg_opt)
+    {
+        for (auto it = msg_opts.begin(); it != msg_opts.end();) {
+            if (std::get<0>(it->first) == (MPI_Comm) group) {
+                it = msg_opts.erase(it);
+            } else {
+                it++;
+            }
+        }
+        for (auto it = remote_peers.begin(); it != remote_peers.end();) {
+            if (it->first == (MPI_Comm) group) {
+                it = remote_peers.erase(it);
+            } else {
+                it++;
+            }
+        }
+        for (auto it = links.begin(); it != links.end();) {
+            if (it->first.first == (MPI_Comm) group) {
+                it = links.erase(it);
+            } else {
+                it++;
+            }
+        }
+    }
+}
+
 void IMpi::recvVoid(const MPI::Intracomm &group, storage::IVoidPartition &part, int source, int tag) {
     MsgOpt opt = getMsgOpt(group, part.type(), false, source, tag);
     recvVoid(group, part, source,tag, opt);
@@ -125,10 +489,10 @@ void IMpi::recvVoid(const MPI::Intracomm &group, storage::IVoidPartition &part,
 
 void IMpi::recvVoid(const MPI::Intracomm &group, storage::IVoidPartition &part, int source, int tag, const MsgOpt &o){
     auto buffer = std::make_shared<transport::IMemoryBuffer>(part.bytes());
-    int sz;
+    int64_t sz;
 
-    group.Recv(&sz, 1, MPI::INT, source, tag);
-    group.Recv(buffer->getWritePtr(sz), sz, MPI::BYTE, source, tag);
+    group.Recv(&sz, 1, MPI::LONG, source, tag);
+    recvBytes(group, buffer->getWritePtr(sz), sz, source, tag);
     buffer->wroteBytes(sz);
     part.read((std::shared_ptr<transport::ITransport> &) buffer);
 }
@@ -8,7 +8,11 @@
 #include "ignis/executor/core/ILog.h"
 #include "storage/IPartition.h"
 #include "storage/IVoidPartition.h"
+#include "transport/IMemoryBuffer.h"
+#include <map>
 #include <mpi.h>
+#include <set>
+#include <tuple>
 
 namespace ignis {
     namespace executor {
@@ -23,6 +27,10 @@ namespace ignis {
                 template<typename Tp>
                 void bcast(storage::IPartition<Tp> &part, int root);
 
+                /*Every executor ends with the elements of all executors in rank order, only memory partitions*/
+                template<typename Tp>
+                void allgather(storage::IPartition<Tp> &part);
+
                 template<typename Tp>
                 void driverGather(const MPI::Intracomm &group, storage::IPartitionGroup<Tp> &part_group);
 
@@ -43,6 +51,9 @@ namespace ignis {
 
                 MsgOpt getMsgOpt(const MPI::Intracomm &group, const std::string &ptype, bool send, int other, int tag);
 
+                /*Forgets the options negotiated in a group, must be called before the group is freed*/
+                void clearMsgOpt(const MPI::Comm &group);
+
                 template<typename Tp>
                 void send(const MPI::Intracomm &group, storage::IPartition<Tp> &part, int dest, int tag);
 
@@ -84,13 +95,66 @@ namespace ignis {
                 template<typename Tp>
                 bool isContiguousType();
 
+                /*Largest message sent in a single mpi call*/
+                int64_t chunkSize();
+
             private:
-                std::vector<int> szVector(const std::vector<std::pair<int, int>> &elems_szv);
+                std::vector<int64_t> szVector(const std::vector<std::pair<int64_t, int64_t>> &elems_szv);
 
-                int sumElems(const std::vector<std::pair<int, int>> &elems_szv);
+                int64_t sumElems(const std::vector<std::pair<int64_t, int64_t>> &elems_szv);
 
                 std::vector<int> displs(const std::vector<int> &sz);
 
+                std::vector<int64_t> displs(const std::vector<int64_t> &sz);
+
+                /*Byte transfers of any size, messages larger than chunkSize are split*/
+                void sendBytes(const MPI::Intracomm &group, const void *buf, int64_t n, int dest, int tag);
+
+                void recvBytes(const MPI::Intracomm &group, void *buf, int64_t n, int source, int tag);
+
+                void bcastBytes(const MPI::Intracomm &group, void *buf, int64_t n, int root);
+
+                /*Executors on the same node read the buffer directly from the sender memory, both sides must call
+                 * them with the same n and the sender buffer must be alive until the function returns*/
+                void sendShared(const MPI::Intracomm &group, const void *buf, int64_t n, int dest, int tag);
+
+                void recvShared(const MPI::Intracomm &group, void *buf, int64_t n, int source, int tag);
+
+                bool useShared(const MPI::Intracomm &group, int64_t n, int other);
+
+                void remotePeer(const MPI::Intracomm &group, int other);
+
+                /*Copies n bytes at addr of process pid, false if the memory cannot be read*/
+                bool readProcess(int64_t pid, int64_t addr, void *buf, int64_t n);
+
+                int64_t nodeId();
+
+                /*Serializes part in buffer for a message to peer and returns its size, with adaptive compression
+                 * memory partitions are serialized uncompressed and compressed as decided by the link statistics*/
+                template<typename Tp>
+                int64_t writeMsg(const MPI::Intracomm &group, storage::IPartition<Tp> &part,
+                                 std::shared_ptr<transport::IMemoryBuffer> &buffer, int peer);
+
+                int64_t adaptMsg(const MPI::Intracomm &group, std::shared_ptr<transport::IMemoryBuffer> &buffer,
+                                 int peer);
+
+                int8_t linkCompression(const MPI::Intracomm &group, const uint8_t *data, int64_t n, int peer);
+
+                /*Compresses the first block of data, returns the ratio and sets the bytes per second*/
+                double sampleCompression(int8_t compression, const uint8_t *data, int64_t n, double &speed);
+
+                void linkSpeed(const MPI::Intracomm &group, int peer, int64_t n, double seconds);
+
+                /*All ranks must know szv, the root block is not transferred*/
+                void gathervBytes(const MPI::Intracomm &group, const void *send, void *rcv,
+                                  const std::vector<int64_t> &szv, int root);
+
+                void scattervBytes(const MPI::Intracomm &group, const void *send, void *rcv,
+                                   const std::vector<int64_t> &szv, int root);
+
+                void allgathervBytes(const MPI::Intracomm &group, const void *send, void *rcv,
+                                     const std::vector<int64_t> &szv);
+
                 void move(void *begin, size_t n, size_t displ);
 
                 template<typename Tp>
@@ -111,6 +175,16 @@ namespace ignis {
                 IPropertyParser &properties;
                 IPartitionTools &partition_tools;
                 api::IContext &context;
+                std::map<std::tuple<MPI_Comm, int, bool>, std::pair<std::string, MsgOpt>> msg_opts;
+                std::set<std::pair<MPI_Comm, int>> remote_peers;
+
+                typedef struct {
+                    int8_t compression;
+                    int64_t msgs;
+                    double speed;
+                } LinkStats;
+
+                std::map<std::pair<MPI_Comm, int>, LinkStats> links;
             };
         }// namespace core
     }    // namespace executor
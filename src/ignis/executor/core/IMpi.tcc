@@ -5,6 +5,7 @@
 #include "storage/IDiskPartition.h"
 #include "storage/IMemoryPartition.h"
 #include "storage/IRawMemoryPartition.h"
+#include "transport/IBcastTransport.h"
 
 #include <iostream>
 
@@ -20,50 +21,72 @@ void IMpiClass::gather(storage::IPartition<Tp> &part, int root) {
 template<typename Tp>
 void IMpiClass::bcast(storage::IPartition<Tp> &part, int root) {
     if (executors() == 1) { return; }
-    if (part.type() == storage::IMemoryPartition<Tp>::TYPE) {
-        if (isContiguousType<Tp>()) {
-            auto &men = partition_tools.toMemory(part);
-            int sz = men.size();
-            native().Bcast(&sz, 1, MPI::INT, root);
-            if (!isRoot(root)) { men.resize(sz); }
-            native().Bcast(&men[0], sz * sizeof(Tp), MPI::BYTE, root);
-        } else {
-            auto buffer = std::make_shared<transport::IMemoryBuffer>(part.bytes());
-            int sz;
-            if (isRoot(root)) {
-                part.write((std::shared_ptr<transport::ITransport> &) buffer, properties.msgCompression());
-                sz = buffer->writeEnd();
-                buffer->resetBuffer();
-            }
-            native().Bcast(&sz, 1, MPI::INT, root);
-            native().Bcast(buffer->getWritePtr(sz), sz, MPI::BYTE, root);
-            if (!isRoot(root)) {
-                buffer->wroteBytes(sz);
-                part.clear();
-                part.read((std::shared_ptr<transport::ITransport> &) buffer);
-            }
-        }
+    if (part.type() == storage::IMemoryPartition<Tp>::TYPE && isContiguousType<Tp>()) {
+        auto &men = partition_tools.toMemory(part);
+        int64_t sz = men.size();
+        native().Bcast(&sz, 1, MPI::LONG, root);
+        if (!isRoot(root)) { men.resize(sz); }
+        bcastBytes(native(), &men[0], sz * sizeof(Tp), root);
     } else if (part.type() == storage::IRawMemoryPartition<Tp>::TYPE) {
         auto &raw = partition_tools.toRawMemory(part);
         raw.sync();
-        std::pair<int, int> sz(raw.size(), (int) (raw.end() - raw.begin(false)));
-        native().Bcast(&sz, 2, MPI::INT, root);
+        std::pair<int64_t, int64_t> sz(raw.size(), raw.end() - raw.begin(false));
+        native().Bcast(&sz, 2, MPI::LONG, root);
         if (!isRoot(root)) { raw.resize(sz.first, sz.second); }
-        native().Bcast(raw.begin(false), sz.second, MPI::BYTE, root);
+        bcastBytes(native(), raw.begin(false), sz.second, root);
     } else {
-        auto &disk = partition_tools.toDisk(part);
-        disk.sync();
-        std::string path = disk.getPath();
-        int sz = path.size();
-        native().Bcast(&sz, 1, MPI::INT, root);
-        path.resize(sz);
-        native().Bcast(const_cast<char *>(path.c_str()), sz, MPI::BYTE, root);
-        if (!isRoot(root)) {
-            disk.destroy = true;
-            auto rcv = partition_tools.copyDiskPartition<Tp>(path);
-            std::swap(disk, *rcv);
+        /*Serialized in chunks, the root never holds the whole message and no shared filesystem is needed*/
+        auto trans = std::make_shared<transport::IBcastTransport>(native(), root, chunkSize());
+        if (isRoot(root)) {
+            part.write((std::shared_ptr<transport::ITransport> &) trans, properties.msgCompression());
+        } else {
+            part.clear();
+            part.read((std::shared_ptr<transport::ITransport> &) trans);
+        }
+        trans->finish();
+    }
+}
+
+template<typename Tp>
+void IMpiClass::allgather(storage::IPartition<Tp> &part) {
+    if (executors() == 1) { return; }
+    if (part.type() != storage::IMemoryPartition<Tp>::TYPE) {
+        throw exception::ILogicError("allgather only supports memory partitions");
+    }
+    auto &men = partition_tools.toMemory(part);
+    int rank = this->rank();
+    std::vector<int64_t> szv(executors());
+    if (isContiguousType<Tp>()) {
+        int64_t sz = men.size() * sizeof(Tp);
+        native().Allgather(&sz, 1, MPI::LONG, &szv[0], 1, MPI::LONG);
+        auto displs = this->displs(szv);
+        storage::IMemoryPartition<Tp> rcv;
+        rcv.resize(displs.back() / sizeof(Tp));
+        allgathervBytes(native(), &men[0], &rcv[0], szv);
+        std::swap(men.inner(), rcv.inner());
+    } else {
+        auto buffer = std::make_shared<transport::IMemoryBuffer>();
+        part.write((std::shared_ptr<transport::ITransport> &) buffer, properties.msgCompression());
+        uint8_t *data;
+        size_t data_sz;
+        buffer->getBuffer(&data, &data_sz);
+        int64_t sz = data_sz;
+        native().Allgather(&sz, 1, MPI::LONG, &szv[0], 1, MPI::LONG);
+        auto displs = this->displs(szv);
+        std::vector<uint8_t> all(displs.back());
+        allgathervBytes(native(), data, &all[0], szv);
+        buffer.reset();
+        storage::IMemoryPartition<Tp> rcv;
+        for (int i = 0; i < executors(); i++) {
+            if (i != rank) {
+                auto view = std::make_shared<transport::IMemoryBuffer>(&all[displs[i]], szv[i]);
+                rcv.read((std::shared_ptr<transport::ITransport> &) view);
+            } else {
+                /*Avoid deserializing own elements*/
+                part.moveTo(rcv);
+            }
         }
-        native().Barrier();
+        std::swap(men.inner(), rcv.inner());
     }
 }
 
@@ -135,6 +158,7 @@ void IMpiClass::driverGather0(const MPI::Intracomm &group, storage::IPartitionGr
     int rank = group.Get_rank();
     auto sub_group = group.Split(rank < 2, rank);
     if (rank < 2) { driverGather(sub_group, part_group); }
+    clearMsgOpt(sub_group);
     sub_group.Free();
 }
 
@@ -148,9 +172,8 @@ void IMpiClass::driverScatter(const MPI::Intracomm &group, storage::IPartitionGr
     bool same_protocol;
     int64_t sz = 0;
     uint8_t *src = nullptr;
-    std::vector<int> partsv;
-    std::vector<int> szv;
-    std::vector<int> displs;
+    std::vector<int64_t> partsv;
+    std::vector<int64_t> szv;
     auto buffer = std::make_shared<transport::IMemoryBuffer>();
 
     int8_t protocol = core::protocol::IObjectProtocol::CPP_PROTOCOL;
@@ -180,21 +203,11 @@ void IMpiClass::driverScatter(const MPI::Intracomm &group, storage::IPartitionGr
         partsv.insert(partsv.end(), partitions - remainder, execs_elems * sizeof(Tp));
         partsv.resize(execs_parts * (execs + 1), 0);
 
-        szv.push_back(0);
-        displs.push_back(0);
-        int64_t offset = 0;
-        if (isContiguousType<Tp>() && same_protocol) {
-            for (int64_t i = execs_parts; i < partsv.size(); i++) {
-                offset += partsv[i];
-                if ((i + 1) % execs_parts == 0) {
-                    displs.push_back(szv.back() + displs.back());
-                    szv.push_back(offset - displs.back());
-                }
-            }
-        } else {
+        if (!isContiguousType<Tp>() || !same_protocol) {
             auto cmp = properties.msgCompression();
             auto zlib = std::make_shared<transport::IZlibTransport>(buffer, cmp);
             protocol::IObjectProtocol proto(zlib);
+            int64_t offset = 0;
             int64_t wrote = 0;
             for (int64_t i = execs_parts; i < partsv.size(); i++) {
                 proto.writeObject(api::IVector<Tp>::view((Tp *) &src[offset], partsv[i] / sizeof(Tp)));
@@ -203,25 +216,25 @@ void IMpiClass::driverScatter(const MPI::Intracomm &group, storage::IPartitionGr
                 zlib->reset();
                 partsv[i] = buffer->writeEnd() - wrote;
                 wrote += partsv[i];
-                if ((i + 1) % execs_parts == 0) {
-                    displs.push_back(szv.back() + displs.back());
-                    szv.push_back(buffer->writeEnd() - displs.back());
-                }
             }
             src = buffer->getWritePtr(0) - buffer->writeEnd();
         }
     } else {
-        partsv.resize(execs_parts, 0);
+        partsv.resize(execs_parts * (execs + 1), 0);
     }
 
-    group.Scatter(&partsv[0], execs_parts, MPI::INT, driver ? MPI_IN_PLACE : &partsv[0], execs_parts, MPI::INT, 0);
+    /*All executors know every size, so large scatters are split the same way everywhere*/
+    group.Bcast(&partsv[0], partsv.size(), MPI::LONG, 0);
+    szv.resize(execs + 1, 0);
+    for (int64_t i = 0; i < partsv.size(); i++) { szv[i / execs_parts] += partsv[i]; }
 
     if (!driver) {
-        for (auto &len : partsv) { sz += len; }
+        partsv = std::vector<int64_t>(partsv.begin() + id * execs_parts, partsv.begin() + (id + 1) * execs_parts);
+        sz = szv[id];
         src = buffer->getWritePtr(sz);
     }
 
-    group.Scatterv(src, &szv[0], &displs[0], MPI::BYTE, driver ? MPI_IN_PLACE : src, sz, MPI::BYTE, 0);
+    scattervBytes(group, src, src, szv, 0);
 
     if (!driver) {
         if (isContiguousType<Tp>() && same_protocol) {
@@ -299,39 +312,26 @@ void IMpiClass::gatherImpl(const MPI::Intracomm &group, storage::IPartition<Tp>
     if (part.type() == storage::IMemoryPartition<Tp>::TYPE) {
         if (isContiguousType<Tp>() && same_protocol) {
             auto &men = partition_tools.toMemory(part);
-            int sz = men.size() * sizeof(Tp);
-            std::vector<int> szv;
-            std::vector<int> displs;
-            if (rank == root) { szv.resize(executors, sz); }
-            group.Gather(&sz, 1, MPI::INT, &szv[0], 1, MPI::INT, root);
+            int64_t sz = men.size() * sizeof(Tp);
+            std::vector<int64_t> szv(executors);
+            group.Allgather(&sz, 1, MPI::LONG, &szv[0], 1, MPI::LONG);
             if (rank == root) {
-                displs = this->displs(szv);
+                auto displs = this->displs(szv);
                 men.resize(displs.back() / sizeof(Tp));
                 //Use same buffer to rcv elements
                 move(&men[0], szv[rank], displs[rank]);
-                group.Gatherv(MPI::IN_PLACE, 0, MPI::BYTE, &men[0], &szv[0], &displs[0], MPI::BYTE, root);
-            } else {
-                group.Gatherv(&men[0], sz, MPI::BYTE, nullptr, nullptr, nullptr, MPI::BYTE, root);
             }
+            gathervBytes(group, &men[0], &men[0], szv, root);
         } else {
             auto &men = partition_tools.toMemory(part);
             auto buffer = std::make_shared<transport::IMemoryBuffer>();
-            int sz = 0;
-            std::vector<int> szv;
-            std::vector<int> displs;
-            if (rank != root) {
-                part.write((std::shared_ptr<transport::ITransport> &) buffer, properties.msgCompression());
-                sz = buffer->writeEnd();
-                buffer->resetBuffer();
-            }
-            if (rank == root) { szv.resize(executors, sz); }
-            group.Gather(&sz, 1, MPI::INT, &szv[0], 1, MPI::INT, root);
-            if (rank == root) {
-                displs = this->displs(szv);
-                buffer->getWritePtr(displs.back());
-            }
-            group.Gatherv(buffer->getWritePtr(sz), sz, MPI::BYTE, buffer->getWritePtr(sz), &szv[0], &displs[0],
-                          MPI::BYTE, root);
+            int64_t sz = 0;
+            std::vector<int64_t> szv(executors);
+            if (rank != root) { sz = writeMsg(group, part, buffer, root); }
+            group.Allgather(&sz, 1, MPI::LONG, &szv[0], 1, MPI::LONG);
+            auto displs = this->displs(szv);
+            if (rank == root) { buffer->getWritePtr(displs.back()); }
+            gathervBytes(group, buffer->getWritePtr(sz), buffer->getWritePtr(sz), szv, root);
             if (rank == root) {
                 auto ptr = buffer->getWritePtr(sz);
                 storage::IMemoryPartition<Tp> rcv;
@@ -360,23 +360,17 @@ void IMpiClass::gatherImpl(const MPI::Intracomm &group, storage::IPartition<Tp>
             group.Gather(raw.begin(false) - HEADER, HEADER, MPI::BYTE, buffer.getWritePtr(0), HEADER, MPI::BYTE, root);
             //C++ ignore headers
         }
-        std::pair<int, int> sz(raw.size(), raw.end() - raw.begin(false));
-        std::vector<std::pair<int, int>> elems_szv;
-        std::vector<int> szv;
-        std::vector<int> displs;
-        if (rank == root) { elems_szv.resize(executors, sz); }
-        group.Gather(&sz, 2, MPI::INT, &elems_szv[0], 2, MPI::INT, root);
+        std::pair<int64_t, int64_t> sz(raw.size(), raw.end() - raw.begin(false));
+        std::vector<std::pair<int64_t, int64_t>> elems_szv(executors);
+        group.Allgather(&sz, 2, MPI::LONG, &elems_szv[0], 2, MPI::LONG);
+        auto szv = this->szVector(elems_szv);
         if (rank == root) {
-            szv = this->szVector(elems_szv);
-            displs = this->displs(szv);
+            auto displs = this->displs(szv);
             auto n = sumElems(elems_szv);
             raw.resize(n, displs.back());
-            auto ptr = raw.begin(false);
-            move(ptr, szv[rank], displs[rank]);
-            group.Gatherv(MPI::IN_PLACE, 0, MPI::BYTE, ptr, &szv[0], &displs[0], MPI::BYTE, root);
-        } else {
-            group.Gatherv(raw.begin(false), sz.second, MPI::BYTE, nullptr, nullptr, nullptr, MPI::BYTE, root);
+            move(raw.begin(false), szv[rank], displs[rank]);
         }
+        gathervBytes(group, raw.begin(false), raw.begin(false), szv, root);
     } else {
         auto &disk = partition_tools.toDisk(part);
         disk.sync();
@@ -427,16 +421,16 @@ void IMpiClass::sendRecv(const MPI::Intracomm &group, storage::IPartition<Tp> &p
         sendRecvImpl(group, part, source, dest, tag, opt.same_protocol);
     } else {
         auto buffer = std::make_shared<transport::IMemoryBuffer>(part.bytes());
-        int sz;
+        int64_t sz;
         if (id == source) {
-            part.write((std::shared_ptr<transport::ITransport> &) buffer, properties.msgCompression());
-            sz = buffer->writeEnd();
-            buffer->resetBuffer();
-            group.Send(&sz, 1, MPI::INT, dest, tag);
-            group.Send(buffer->getWritePtr(sz), sz, MPI::BYTE, dest, tag);
+            sz = writeMsg(group, part, buffer, dest);
+            group.Send(&sz, 1, MPI::LONG, dest, tag);
+            double start = MPI::Wtime();
+            sendBytes(group, buffer->getWritePtr(sz), sz, dest, tag);
+            linkSpeed(group, dest, sz, MPI::Wtime() - start);
         } else {
-            group.Recv(&sz, 1, MPI::INT, source, tag);
-            group.Recv(buffer->getWritePtr(sz), sz, MPI::BYTE, source, tag);
+            group.Recv(&sz, 1, MPI::LONG, source, tag);
+            recvBytes(group, buffer->getWritePtr(sz), sz, source, tag);
             buffer->wroteBytes(sz);
             part.read((std::shared_ptr<transport::ITransport> &) buffer);
         }
@@ -450,28 +444,28 @@ void IMpiClass::sendRecvImpl(const MPI::Intracomm &group, storage::IPartition<Tp
     if (part.type() == storage::IMemoryPartition<Tp>::TYPE) {
         if (isContiguousType<Tp>() && same_protocol) {
             auto &men = reinterpret_cast<storage::IMemoryPartition<Tp> &>(part);
-            int sz = men.size();
+            int64_t sz = men.size();
             if (id == source) {
-                group.Send(&sz, 1, MPI::INT, dest, tag);
-                group.Send(&men[0], sz * sizeof(Tp), MPI::BYTE, dest, tag);
+                group.Send(&sz, 1, MPI::LONG, dest, tag);
+                sendShared(group, &men[0], sz * sizeof(Tp), dest, tag);
             } else {
-                int init = sz;
-                group.Recv(&sz, 1, MPI::INT, source, tag);
+                int64_t init = sz;
+                group.Recv(&sz, 1, MPI::LONG, source, tag);
                 men.resize(init + sz);
-                group.Recv(&men[init], sz * sizeof(Tp), MPI::BYTE, source, tag);
+                recvShared(group, &men[init], sz * sizeof(Tp), source, tag);
             }
         } else {
             auto buffer = std::make_shared<transport::IMemoryBuffer>(part.bytes());
-            int sz;
+            int64_t sz;
             if (id == source) {
-                part.write((std::shared_ptr<transport::ITransport> &) buffer, properties.msgCompression());
-                sz = buffer->writeEnd();
-                buffer->resetBuffer();
-                group.Send(&sz, 1, MPI::INT, dest, tag);
-                group.Send(buffer->getWritePtr(sz), sz, MPI::BYTE, dest, tag);
+                sz = writeMsg(group, part, buffer, dest);
+                group.Send(&sz, 1, MPI::LONG, dest, tag);
+                double start = MPI::Wtime();
+                sendBytes(group, buffer->getWritePtr(sz), sz, dest, tag);
+                linkSpeed(group, dest, sz, MPI::Wtime() - start);
             } else {
-                group.Recv(&sz, 1, MPI::INT, source, tag);
-                group.Recv(buffer->getWritePtr(sz), sz, MPI::BYTE, source, tag);
+                group.Recv(&sz, 1, MPI::LONG, source, tag);
+                recvBytes(group, buffer->getWritePtr(sz), sz, source, tag);
                 buffer->wroteBytes(sz);
                 part.read((std::shared_ptr<transport::ITransport> &) buffer);
             }
@@ -488,20 +482,32 @@ void IMpiClass::sendRecvImpl(const MPI::Intracomm &group, storage::IPartition<Tp
                 group.Recv(&raw.header_size, 1, MPI::INT, source, tag);
             }
         }
-        std::pair<int, int> sz(raw.size(), (int) (raw.end() - raw.begin(false) + HEADER));
+        std::pair<int64_t, int64_t> sz(raw.size(), raw.end() - raw.begin(false) + HEADER);
         if (id == source) {
-            group.Send(&sz, 2, MPI::INT, dest, tag);
-            group.Send(raw.begin(false) - HEADER, sz.second, MPI::BYTE, dest, tag);
+            group.Send(&sz, 2, MPI::LONG, dest, tag);
+            if (same_protocol) {
+                sendShared(group, raw.begin(false) - HEADER, sz.second, dest, tag);
+            } else {
+                sendBytes(group, raw.begin(false) - HEADER, sz.second, dest, tag);
+            }
         } else {
-            group.Recv(&sz, 2, MPI::INT, source, tag);
+            group.Recv(&sz, 2, MPI::LONG, source, tag);
             if (part.empty()) {
                 raw.resize(sz.first, sz.second - HEADER);
-                group.Recv(raw.begin(false) - HEADER, sz.second, MPI::BYTE, source, tag);
+                if (same_protocol) {
+                    recvShared(group, raw.begin(false) - HEADER, sz.second, source, tag);
+                } else {
+                    recvBytes(group, raw.begin(false) - HEADER, sz.second, source, tag);
+                }
                 raw.writeHeader();
             } else {
                 storage::IRawMemoryPartition<Tp> tmp;
                 tmp.resize(sz.first, sz.second - HEADER);
-                group.Recv(raw.begin(false) - HEADER, sz.second, MPI::BYTE, source, tag);
+                if (same_protocol) {
+                    recvShared(group, tmp.begin(false) - HEADER, sz.second, source, tag);
+                } else {
+                    recvBytes(group, tmp.begin(false) - HEADER, sz.second, source, tag);
+                }
                 tmp.writeHeader();
                 tmp.moveTo(raw);
             }
@@ -531,6 +537,23 @@ void IMpiClass::sendRecvImpl(const MPI::Intracomm &group, storage::IPartition<Tp
     }
 }
 
+template<typename Tp>
+int64_t IMpiClass::writeMsg(const MPI::Intracomm &group, storage::IPartition<Tp> &part,
+                            std::shared_ptr<transport::IMemoryBuffer> &buffer, int peer) {
+    if (properties.transportAdaptive() <= 0) {
+        part.write((std::shared_ptr<transport::ITransport> &) buffer, properties.msgCompression());
+    } else if (part.type() == storage::IMemoryPartition<Tp>::TYPE) {
+        part.write((std::shared_ptr<transport::ITransport> &) buffer, 0);
+        return adaptMsg(group, buffer, peer);
+    } else {
+        //Stored partitions are already compressed, they are sent as they are
+        part.write((std::shared_ptr<transport::ITransport> &) buffer);
+    }
+    int64_t sz = buffer->writeEnd();
+    buffer->resetBuffer();
+    return sz;
+}
+
 template<typename Tp>
 bool IMpiClass::isContiguousType() {
     return io::isContiguous<Tp>()();
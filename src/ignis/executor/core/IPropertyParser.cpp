@@ -1,6 +1,7 @@
 
 #include "IPropertyParser.h"
 #include "exception/IInvalidArgument.h"
+#include "transport/ICodec.h"
 #include <math.h>
 #include <regex>
 #include <sstream>
@@ -15,6 +16,12 @@ std::string &IPropertyParser::getString(const std::string &key) {
     throw exception::IInvalidArgument(key + " is empty");
 }
 
+std::string IPropertyParser::getString(const std::string &key, const std::string &defaultValue) {
+    auto value = properties.find(key);
+    if (value != properties.end()) { return value->second; }
+    return defaultValue;
+}
+
 int64_t IPropertyParser::getNumber(const std::string &key) {
     std::string &value = getString(key);
     try {
@@ -45,6 +52,11 @@ int64_t IPropertyParser::getMinNumber(const std::string &key, const int64_t min)
     return value;
 }
 
+int64_t IPropertyParser::getMinNumber(const std::string &key, const int64_t min, int64_t defaultValue) {
+    if (properties.find(key) == properties.end()) { return defaultValue; }
+    return getMinNumber(key, min);
+}
+
 int64_t IPropertyParser::getMaxNumber(const std::string &key, const int64_t max) {
     auto value = getNumber(key);
     if (value > max) {
@@ -95,6 +107,12 @@ double IPropertyParser::getRangeDouble(const std::string &key, const double min,
     return value;
 }
 
+double IPropertyParser::getRangeDouble(const std::string &key, const double min, const double max,
+                                       double defaultValue) {
+    if (properties.find(key) == properties.end()) { return defaultValue; }
+    return getRangeDouble(key, min, max);
+}
+
 void IPropertyParser::parserError(const std::string &key, const std::string &value, size_t pos) {
     std::stringstream ss;
     ss << key << " parsing error " << value[pos] << "(" << pos + 1 << ") in " << value;
@@ -106,7 +124,7 @@ size_t IPropertyParser::getSize(const std::string &key) {
     std::string UNITS = "KMGTPEZY";
     double num;
     size_t base;
-    size_t exp;
+    size_t exp = 0;
     bool decimal = false;
     size_t i = 0;
     size_t len = value.length();
@@ -152,8 +170,49 @@ size_t IPropertyParser::getSize(const std::string &key) {
     return (size_t) ceil(num * pow(base, exp));
 }
 
+size_t IPropertyParser::getSize(const std::string &key, size_t defaultValue) {
+    if (properties.find(key) == properties.end()) { return defaultValue; }
+    return getSize(key);
+}
+
 bool IPropertyParser::getBoolean(const std::string &key) {
     return std::regex_search(getString(key), std::regex("y|Y|yes|Yes|YES|true|True|TRUE|on|On|ON"));
 }
 
+std::string IPropertyParser::joinType() {
+    std::string type = getString("ignis.modules.join.type", "shuffle");
+    if (type != "auto" && type != "shuffle" && type != "broadcast" && type != "merge") {
+        throw exception::IInvalidArgument("ignis.modules.join.type must be auto, shuffle, broadcast or merge, find '" +
+                                          type + "'");
+    }
+    return type;
+}
+
+int8_t IPropertyParser::codecCompression(const std::string &key, int64_t level) {
+    std::string name = getString(key, "zlib");
+    int16_t codec;
+    int64_t max;
+    if (name == "zlib") {
+        codec = transport::ICodec::ZLIB;
+        max = 9;
+    } else if (name == "lz4") {
+        codec = transport::ICodec::LZ4;
+        max = 12;
+    } else if (name == "zstd") {
+        codec = transport::ICodec::ZSTD;
+        max = 22;
+    } else if (name == "zstd-long") {
+        codec = transport::ICodec::ZSTD_LONG;
+        max = 22;
+    } else {
+        throw exception::IInvalidArgument(key + " must be zlib, lz4, zstd or zstd-long, find '" + name + "'");
+    }
+    if (level < 0 || level > max) {
+        std::stringstream ss;
+        ss << key << " error " << name << " compression level " << level << " is not in [0, " << max << "]";
+        throw exception::IInvalidArgument(ss.str());
+    }
+    return transport::ICodec::compression(codec, level);
+}
+
 IPropertyParser::~IPropertyParser() {}
@@ -26,22 +26,70 @@ namespace ignis {
 
                 bool sortResampling() { return getBoolean("ignis.modules.sort.resampling"); }
 
+                /*Memory of the key tables before they spill to disk, 0 means no limit*/
+                int64_t reduceMemory() { return getSize("ignis.modules.reduce.memory", 0); }
+
+                /*Fraction of the elements that makes a key heavy, 0 disables the skew handling*/
+                double reduceSkew() { return getRangeDouble("ignis.modules.reduce.skew", 0, 1, 0); }
+
+                /*auto, shuffle, broadcast or merge, shuffle is the hash join*/
+                std::string joinType();
+
+                /*Bytes of the smallest input that make auto broadcast it, 0 never does*/
+                int64_t joinBroadcast() { return getSize("ignis.modules.join.broadcast", 0); }
+
                 int64_t ioOverwrite() { return getBoolean("ignis.modules.io.overwrite"); }
 
                 double ioCores() { return getMinDouble("ignis.modules.io.cores", 0); }
 
-                int8_t ioCompression() { return getRangeNumber("ignis.modules.io.compression", 0, 9); }
+                int8_t ioCompression() { return ioCompression(getNumber("ignis.modules.io.compression")); }
+
+                int8_t ioCompression(int64_t level) { return codecCompression("ignis.modules.io.codec", level); }
+
+                /*Rows of each row group in columnar object files, 0 saves object files by rows*/
+                int64_t ioColumnar() { return getMinNumber("ignis.modules.io.columnar", 0, 0); }
+
+                /*Bytes of the blocks of row object files, readers split the blocks of a file between threads*/
+                int64_t ioBlock() { return getSize("ignis.modules.io.block", 64 * 1024 * 1024); }
+
+                /*Threads writing saved files in background, 0 writes them in the threads that format them*/
+                int64_t ioWriters() { return getMinNumber("ignis.modules.io.writers", 0, 0); }
+
+                int8_t msgCompression() {
+                    return codecCompression("ignis.transport.codec", getNumber("ignis.transport.compression"));
+                }
+
+                int8_t partitionCompression() {
+                    return codecCompression("ignis.partition.codec", getNumber("ignis.partition.compression"));
+                }
 
-                int8_t msgCompression() { return getRangeNumber("ignis.transport.compression", 0, 9); }
+                /*Bytes of the buffers that copy partition data, 1MB if unset*/
+                int64_t partitionBuffer() { return getSize("ignis.partition.buffer", 1024 * 1024); }
 
-                int8_t partitionCompression() { return getRangeNumber("ignis.partition.compression", 0, 9); }
+                /*Smallest disk partition read through a memory mapping, 0 disables the mapping*/
+                int64_t partitionMmap() { return getSize("ignis.partition.mmap", 0); }
+
+                /*Worker threads of each zstd stream, 0 compresses in the calling thread*/
+                int64_t codecThreads() { return getMinNumber("ignis.executor.codec.threads", 0, 0); }
 
                 int64_t transportElemSize() { return getSize("ignis.transport.element.size"); }
 
+                /*Largest message of the transport, 0 splits messages only when they exceed the int limit of MPI*/
+                int64_t transportChunk() { return getSize("ignis.transport.chunk", 0); }
+
+                /*Smallest message read from the memory of an executor on the same node, 0 disables it*/
+                int64_t transportShared() { return getSize("ignis.transport.shared", 0); }
+
+                /*Smallest message whose compression is chosen per link, 0 always uses the configured level*/
+                int64_t transportAdaptive() { return getSize("ignis.transport.adaptive", 0); }
+
                 std::string partitionType() { return getString("ignis.partition.type"); }
 
                 std::string exchangeType() { return getString("ignis.modules.exchange.type"); }
 
+                /*Staging memory of the alltoall exchange, 0 means no limit*/
+                int64_t exchangeMemory() { return getSize("ignis.modules.exchange.memory", 0); }
+
                 std::string jobDirectory() { return getString("ignis.job.directory"); }
 
                 std::string executorDirectory() { return getString("ignis.executor.directory"); }
@@ -50,12 +98,16 @@ namespace ignis {
 
                 std::string &getString(const std::string &key);
 
+                std::string getString(const std::string &key, const std::string &defaultValue);
+
                 int64_t getNumber(const std::string &key);
 
                 double getDouble(const std::string &key);
 
                 int64_t getMinNumber(const std::string &key, const int64_t min);
 
+                int64_t getMinNumber(const std::string &key, const int64_t min, int64_t defaultValue);
+
                 int64_t getMaxNumber(const std::string &key, const int64_t max);
 
                 int64_t getRangeNumber(const std::string &key, const int64_t min, const int64_t max);
@@ -66,10 +118,17 @@ namespace ignis {
 
                 double getRangeDouble(const std::string &key, const double min, const double max);
 
+                double getRangeDouble(const std::string &key, const double min, const double max, double defaultValue);
+
                 size_t getSize(const std::string &key);
 
+                size_t getSize(const std::string &key, size_t defaultValue);
+
                 bool getBoolean(const std::string &key);
 
+                /*Compression byte of the codec named by key, zlib if unset, the valid levels depend on the codec*/
+                int8_t codecCompression(const std::string &key, int64_t level);
+
             private:
                 void parserError(const std::string &key, const std::string &value, size_t pos);
 
@@ -0,0 +1,257 @@
+#include "IColumnFile.h"
+#include "ignis/executor/core/exception/IInvalidArgument.h"
+#include "ignis/executor/core/exception/ILogicError.h"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <fcntl.h>
+#include <thrift/protocol/TCompactProtocol.h>
+#include <unistd.h>
+
+using namespace ignis::executor::core::io;
+using namespace ignis::executor::core;
+using apache::thrift::protocol::TCompactProtocol;
+
+const std::string IColumnFile::MAGIC = "ICOL";
+const int8_t IColumnFile::PLAIN;
+const int8_t IColumnFile::RLE;
+const int8_t IColumnFile::BIT_PACKED;
+const int8_t IColumnFile::DICTIONARY;
+const int8_t IColumnFile::I_FLOAT;
+
+bool IColumnFile::isColumnar(const std::string &path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) { return false; }
+    char magic[4];
+    bool found = ::pread64(fd, magic, sizeof(magic), 0) == sizeof(magic) && MAGIC.compare(0, 4, magic, 4) == 0;
+    ::close(fd);
+    return found;
+}
+
+int IColumnFile::bitWidth(uint64_t max) {
+    int width = 0;
+    while (max > 0) {
+        width++;
+        max >>= 1;
+    }
+    return width;
+}
+
+std::string IColumnFile::pack(const std::vector<uint64_t> &values, int width) {
+    std::string packed;
+    packed.reserve((values.size() * width + 7) / 8);
+    uint64_t acc = 0;
+    int bits = 0;
+    for (auto value : values) {
+        int left = width;
+        while (left > 0) {
+            /*acc keeps less than 8 bits between iterations, 32 more bits always fit*/
+            int n = std::min(left, 32);
+            acc |= (value & ((UINT64_C(1) << n) - 1)) << bits;
+            value >>= n;
+            bits += n;
+            left -= n;
+            while (bits >= 8) {
+                packed.push_back((char) (acc & 0xFF));
+                acc >>= 8;
+                bits -= 8;
+            }
+        }
+    }
+    if (bits > 0) { packed.push_back((char) (acc & 0xFF)); }
+    return packed;
+}
+
+void IColumnFile::unpack(const std::string &packed, int width, std::vector<uint64_t> &values, size_t n) {
+    if (packed.size() < (n * width + 7) / 8) {
+        throw exception::ILogicError("columnar file: bit packed data truncated");
+    }
+    values.resize(n);
+    auto data = reinterpret_cast<const uint8_t *>(packed.data());
+    size_t pos = 0;
+    uint64_t acc = 0;
+    int bits = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t value = 0;
+        int done = 0;
+        while (done < width) {
+            int m = std::min(width - done, 32);
+            while (bits < m) {
+                acc |= (uint64_t) data[pos++] << bits;
+                bits += 8;
+            }
+            value |= (acc & ((UINT64_C(1) << m) - 1)) << done;
+            acc >>= m;
+            bits -= m;
+            done += m;
+        }
+        values[i] = value;
+    }
+}
+
+IColumnFileWriter::IColumnFileWriter(const std::string &path, int8_t compression, const std::vector<int8_t> &kinds)
+    : IColumnFileWriter(std::make_shared<transport::IFileTransport>(path, false, true), compression, kinds) {}
+
+IColumnFileWriter::IColumnFileWriter(const std::shared_ptr<transport::ITransport> &file, int8_t compression,
+                                     const std::vector<int8_t> &kinds)
+    : file(file), buffer(std::make_shared<transport::IMemoryBuffer>()),
+      stats_buffer(std::make_shared<transport::IMemoryBuffer>()),
+      zlib(std::make_shared<transport::IZlibTransport>(buffer, compression)),
+      proto(std::make_shared<TCompactProtocol>(zlib)), stats_proto(std::make_shared<TCompactProtocol>(stats_buffer)),
+      kinds(kinds), offset(0), open(false) {
+    file->write((const uint8_t *) IColumnFile::MAGIC.c_str(), IColumnFile::MAGIC.size());
+    offset += IColumnFile::MAGIC.size();
+}
+
+protocol::IProtocol &IColumnFileWriter::chunk() {
+    if (open) { endChunk(); }
+    buffer->resetBuffer();
+    stats_buffer->resetBuffer();
+    zlib->reset();
+    open = true;
+    return *proto;
+}
+
+protocol::IProtocol &IColumnFileWriter::stats() { return *stats_proto; }
+
+void IColumnFileWriter::endChunk() {
+    zlib->flush();
+    uint8_t *data;
+    size_t size;
+    buffer->getBuffer(&data, &size);
+    IColumnFile::Chunk chunk;
+    chunk.offset = offset;
+    chunk.length = size;
+    chunk.stats = stats_buffer->getBufferAsString();
+    while (size > 0) {
+        uint32_t n = std::min<size_t>(size, INT_MAX);
+        file->write(data, n);
+        data += n;
+        size -= n;
+    }
+    offset += chunk.length;
+    chunks.push_back(std::move(chunk));
+    open = false;
+}
+
+void IColumnFileWriter::endGroup(int64_t rows) {
+    if (open) { endChunk(); }
+    if (chunks.size() != kinds.size()) {
+        throw exception::ILogicError("columnar file: row group with " + std::to_string(chunks.size()) +
+                                     " columns, expected " + std::to_string(kinds.size()));
+    }
+    IColumnFile::Group group;
+    group.rows = rows;
+    group.chunks = std::move(chunks);
+    groups.push_back(std::move(group));
+    chunks.clear();
+}
+
+void IColumnFileWriter::close() {
+    auto footer = std::make_shared<transport::IMemoryBuffer>();
+    TCompactProtocol footer_proto(footer);
+    footer_proto.writeI32(kinds.size());
+    for (auto kind : kinds) { footer_proto.writeByte(kind); }
+    footer_proto.writeI64(groups.size());
+    for (auto &group : groups) {
+        footer_proto.writeI64(group.rows);
+        for (auto &chunk : group.chunks) {
+            footer_proto.writeI64(chunk.offset);
+            footer_proto.writeI64(chunk.length);
+            footer_proto.writeBinary(chunk.stats);
+        }
+    }
+    uint8_t *data;
+    size_t size;
+    footer->getBuffer(&data, &size);
+    int64_t footer_size = size;
+    file->write(data, size);
+    file->write((const uint8_t *) &footer_size, sizeof(footer_size));
+    file->write((const uint8_t *) IColumnFile::MAGIC.c_str(), IColumnFile::MAGIC.size());
+    file->flush();
+}
+
+IColumnFileWriter::~IColumnFileWriter() {}
+
+IColumnFileReader::IColumnFileReader(const std::string &path) : path(path) {
+    fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) { throw exception::IInvalidArgument(path + " cannot be opened"); }
+    try {
+        readFooter();
+    } catch (...) {
+        /*The destructor is not called if the constructor throws*/
+        ::close(fd);
+        throw;
+    }
+}
+
+void IColumnFileReader::readFooter() {
+    int64_t size = ::lseek64(fd, 0, SEEK_END);
+    int64_t trailer = sizeof(int64_t) + IColumnFile::MAGIC.size();
+    char magic[4];
+    int64_t footer_size = 0;
+    if (size >= trailer + (int64_t) IColumnFile::MAGIC.size()) {
+        readFully((uint8_t *) &footer_size, sizeof(footer_size), size - trailer);
+        readFully((uint8_t *) magic, sizeof(magic), size - sizeof(magic));
+    }
+    if (footer_size <= 0 || footer_size > size - trailer || IColumnFile::MAGIC.compare(0, 4, magic, 4) != 0) {
+        throw exception::IInvalidArgument(path + " is not a columnar file");
+    }
+    std::vector<uint8_t> footer_data(footer_size);
+    readFully(&footer_data[0], footer_size, size - trailer - footer_size);
+    auto footer = std::make_shared<transport::IMemoryBuffer>(&footer_data[0], footer_size,
+                                                             transport::IMemoryBuffer::OBSERVE);
+    TCompactProtocol footer_proto(footer);
+    int32_t columns;
+    int64_t groups;
+    footer_proto.readI32(columns);
+    col_kinds.resize(columns);
+    for (auto &kind : col_kinds) { footer_proto.readByte(kind); }
+    footer_proto.readI64(groups);
+    col_groups.resize(groups);
+    for (auto &group : col_groups) {
+        footer_proto.readI64(group.rows);
+        group.chunks.resize(columns);
+        for (auto &chunk : group.chunks) {
+            footer_proto.readI64(chunk.offset);
+            footer_proto.readI64(chunk.length);
+            footer_proto.readBinary(chunk.stats);
+        }
+    }
+}
+
+const std::vector<int8_t> &IColumnFileReader::kinds() { return col_kinds; }
+
+int64_t IColumnFileReader::groups() { return col_groups.size(); }
+
+int64_t IColumnFileReader::rows(int64_t group) { return col_groups[group].rows; }
+
+protocol::IProtocol &IColumnFileReader::chunk(int64_t group, int64_t column) {
+    auto &chunk = col_groups[group].chunks[column];
+    data.resize(chunk.length);
+    readFully(data.data(), chunk.length, chunk.offset);
+    auto buffer = std::make_shared<transport::IMemoryBuffer>(data.data(), data.size(),
+                                                             transport::IMemoryBuffer::OBSERVE);
+    proto = std::make_shared<TCompactProtocol>(std::make_shared<transport::IZlibTransport>(buffer));
+    return *proto;
+}
+
+protocol::IProtocol &IColumnFileReader::stats(int64_t group, int64_t column) {
+    auto &chunk = col_groups[group].chunks[column];
+    auto buffer = std::make_shared<transport::IMemoryBuffer>((uint8_t *) chunk.stats.data(), chunk.stats.size(),
+                                                             transport::IMemoryBuffer::OBSERVE);
+    stats_proto = std::make_shared<TCompactProtocol>(buffer);
+    return *stats_proto;
+}
+
+void IColumnFileReader::readFully(uint8_t *buf, int64_t n, int64_t offset) {
+    while (n > 0) {
+        auto bytes = ::pread64(fd, buf, n, offset);
+        if (bytes <= 0) { throw exception::ILogicError("columnar file: " + path + " read error"); }
+        buf += bytes;
+        n -= bytes;
+        offset += bytes;
+    }
+}
+
+IColumnFileReader::~IColumnFileReader() { ::close(fd); }
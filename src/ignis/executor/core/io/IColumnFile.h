@@ -0,0 +1,125 @@
+#ifndef IGNIS_ICOLUMNFILE_H
+#define IGNIS_ICOLUMNFILE_H
+
+#include "ignis/executor/core/protocol/IProtocol.h"
+#include "ignis/executor/core/transport/IMemoryBuffer.h"
+#include "ignis/executor/core/transport/IZlibTransport.h"
+#include <string>
+#include <vector>
+
+namespace ignis {
+    namespace executor {
+        namespace core {
+            namespace io {
+                /*
+                 * Columnar object file. Elements are stored in row groups, each group keeps every column in its own
+                 * compressed chunk with the min and max of the column. The footer at the end of the file locates the
+                 * chunks, so a reader only decodes the columns and groups it needs.
+                 *
+                 * MAGIC | chunks | footer | footer size (8 bytes) | MAGIC
+                 */
+                class IColumnFile {
+                public:
+                    static const std::string MAGIC;
+
+                    static const int8_t PLAIN = 0;
+                    static const int8_t RLE = 1;
+                    static const int8_t BIT_PACKED = 2;
+                    static const int8_t DICTIONARY = 3;
+
+                    /*Column kinds are IEnumTypes ids, floats are not doubles so they have their own kind*/
+                    static const int8_t I_FLOAT = 0x40;
+
+                    /*Checks the magic at the beginning of the file*/
+                    static bool isColumnar(const std::string &path);
+
+                    /*Bits needed to store values from 0 to max*/
+                    static int bitWidth(uint64_t max);
+
+                    /*Packs the width low bits of every value*/
+                    static std::string pack(const std::vector<uint64_t> &values, int width);
+
+                    static void unpack(const std::string &packed, int width, std::vector<uint64_t> &values, size_t n);
+
+                    struct Chunk {
+                        int64_t offset;
+                        int64_t length;
+                        std::string stats;
+                    };
+
+                    struct Group {
+                        int64_t rows;
+                        std::vector<Chunk> chunks;
+                    };
+                };
+
+                class IColumnFileWriter {
+                public:
+                    IColumnFileWriter(const std::string &path, int8_t compression, const std::vector<int8_t> &kinds);
+
+                    /*Writes the file to a transport positioned at its beginning*/
+                    IColumnFileWriter(const std::shared_ptr<transport::ITransport> &file, int8_t compression,
+                                      const std::vector<int8_t> &kinds);
+
+                    /*Protocol of the next column chunk of the current row group*/
+                    protocol::IProtocol &chunk();
+
+                    /*Protocol of the statistics of the current column chunk*/
+                    protocol::IProtocol &stats();
+
+                    void endGroup(int64_t rows);
+
+                    /*Writes the footer, the file is not valid until it is closed*/
+                    void close();
+
+                    virtual ~IColumnFileWriter();
+
+                private:
+                    void endChunk();
+
+                    std::shared_ptr<transport::ITransport> file;
+                    std::shared_ptr<transport::IMemoryBuffer> buffer, stats_buffer;
+                    std::shared_ptr<transport::IZlibTransport> zlib;
+                    std::shared_ptr<protocol::IProtocol> proto, stats_proto;
+                    std::vector<int8_t> kinds;
+                    std::vector<IColumnFile::Group> groups;
+                    std::vector<IColumnFile::Chunk> chunks;
+                    int64_t offset;
+                    bool open;
+                };
+
+                class IColumnFileReader {
+                public:
+                    IColumnFileReader(const std::string &path);
+
+                    const std::vector<int8_t> &kinds();
+
+                    int64_t groups();
+
+                    int64_t rows(int64_t group);
+
+                    /*Protocol over the decompressed chunk, valid until the next call*/
+                    protocol::IProtocol &chunk(int64_t group, int64_t column);
+
+                    protocol::IProtocol &stats(int64_t group, int64_t column);
+
+                    virtual ~IColumnFileReader();
+
+                private:
+                    void readFooter();
+
+                    void readFully(uint8_t *buf, int64_t n, int64_t offset);
+
+                    std::string path;
+                    int fd;
+                    std::vector<int8_t> col_kinds;
+                    std::vector<IColumnFile::Group> col_groups;
+                    std::vector<uint8_t> data;
+                    std::shared_ptr<protocol::IProtocol> proto, stats_proto;
+                };
+            }// namespace io
+        }    // namespace core
+    }        // namespace executor
+}// namespace ignis
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef IGNIS_ICOLUMNREADER_H
+#define IGNIS_ICOLUMNREADER_H
+
+#include "IColumnType.h"
+#include "ignis/executor/api/IWriteIterator.h"
+
+namespace ignis {
+    namespace executor {
+        namespace core {
+            namespace io {
+                template<typename Tp>
+                class IColumnReader {
+                public:
+                    IColumnReader(const std::string &path);
+
+                    int64_t groups();
+
+                    /*Skips the row groups whose statistics of column prove that no value is in [min, max], rows of the
+                     * other groups are not filtered. Returns the number of new skipped groups*/
+                    template<typename Col>
+                    int64_t filter(int64_t column, const Col &min, const Col &max);
+
+                    void read(api::IWriteIterator<Tp> &out);
+
+                    /*Reads a row group, statistics filters are ignored*/
+                    void readGroup(int64_t group, api::IWriteIterator<Tp> &out);
+
+                    /*Reads only the columns of Col, starting at column*/
+                    template<typename Col>
+                    void read(int64_t column, api::IWriteIterator<Col> &out);
+
+                private:
+                    template<typename Col>
+                    void readColumns(int64_t group, int64_t column, api::IWriteIterator<Col> &out);
+
+                    template<typename Col>
+                    void check(int64_t column);
+
+                    void checkElements();
+
+                    IColumnFileReader file;
+                    std::vector<bool> skip;
+                };
+            }// namespace io
+        }    // namespace core
+    }        // namespace executor
+}// namespace ignis
+
+#include "IColumnReader.tcc"
+
+#endif
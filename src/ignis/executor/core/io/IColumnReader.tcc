@@ -0,0 +1,86 @@
+
+#include "IColumnReader.h"
+#include "ignis/executor/core/exception/IInvalidArgument.h"
+#include <algorithm>
+
+#define IColumnReaderClass ignis::executor::core::io::IColumnReader
+
+template<typename Tp>
+IColumnReaderClass<Tp>::IColumnReader(const std::string &path) : file(path), skip(file.groups(), false) {}
+
+template<typename Tp>
+int64_t IColumnReaderClass<Tp>::groups() {
+    return file.groups();
+}
+
+template<typename Tp>
+template<typename Col>
+int64_t IColumnReaderClass<Tp>::filter(int64_t column, const Col &min, const Col &max) {
+    check<Col>(column);
+    IColumnType<Col> type;
+    int64_t skipped = 0;
+    for (int64_t g = 0; g < file.groups(); g++) {
+        if (!skip[g] && !type.overlaps(file, g, column, min, max)) {
+            skip[g] = true;
+            skipped++;
+        }
+    }
+    return skipped;
+}
+
+template<typename Tp>
+void IColumnReaderClass<Tp>::read(api::IWriteIterator<Tp> &out) {
+    checkElements();
+    for (int64_t g = 0; g < file.groups(); g++) {
+        if (!skip[g]) { readColumns<Tp>(g, 0, out); }
+    }
+}
+
+template<typename Tp>
+void IColumnReaderClass<Tp>::readGroup(int64_t group, api::IWriteIterator<Tp> &out) {
+    checkElements();
+    readColumns<Tp>(group, 0, out);
+}
+
+template<typename Tp>
+template<typename Col>
+void IColumnReaderClass<Tp>::read(int64_t column, api::IWriteIterator<Col> &out) {
+    check<Col>(column);
+    for (int64_t g = 0; g < file.groups(); g++) {
+        if (!skip[g]) { readColumns<Col>(g, column, out); }
+    }
+}
+
+template<typename Tp>
+template<typename Col>
+void IColumnReaderClass<Tp>::readColumns(int64_t group, int64_t column, api::IWriteIterator<Col> &out) {
+    IColumnType<Col> type;
+    typename IColumnType<Col>::Columns columns;
+    type.read(file, group, column, columns);
+    int64_t rows = file.rows(group);
+    for (int64_t i = 0; i < rows; i++) { out.write(type.get(columns, i)); }
+}
+
+template<typename Tp>
+void IColumnReaderClass<Tp>::checkElements() {
+    check<Tp>(0);
+    if (IColumnType<Tp>::columns != file.kinds().size()) {
+        throw exception::IInvalidArgument("columnar file: elements have " + std::to_string(file.kinds().size()) +
+                                          " columns");
+    }
+}
+
+template<typename Tp>
+template<typename Col>
+void IColumnReaderClass<Tp>::check(int64_t column) {
+    std::vector<int8_t> kinds;
+    IColumnType<Col>().kinds(kinds);
+    auto &file_kinds = file.kinds();
+    if (column < 0 || column + kinds.size() > file_kinds.size() ||
+        !std::equal(kinds.begin(), kinds.end(), file_kinds.begin() + column)) {
+        throw exception::IInvalidArgument("columnar file: column " + std::to_string(column) + " is not a " +
+                                          RTTInfo::from<Col>().getStandardName());
+    }
+}
+
+#undef IColumnReaderClass
@@ -0,0 +1,63 @@
+#ifndef IGNIS_ICOLUMNTYPE_H
+#define IGNIS_ICOLUMNTYPE_H
+
+#include "IColumnFile.h"
+#include "IEnumTypes.h"
+#include "ignis/executor/core/RTTInfo.h"
+#include "ignis/executor/core/exception/ILogicError.h"
+#include <vector>
+
+namespace ignis {
+    namespace executor {
+        namespace core {
+            namespace io {
+                /*
+                 * Maps a type to the columns of a columnar file. Numbers, booleans and strings are a column, pairs
+                 * are the columns of the first element followed by the columns of the second one.
+                 */
+                template<typename T, typename Enable = void>
+                struct IColumnType {
+                    static const bool columnar = false;
+                    static const int columns = 0;
+                    typedef std::vector<T> Columns;
+
+                    inline void kinds(std::vector<int8_t> &kinds) {
+                        throw exception::ILogicError("IColumnType not implemented for " +
+                                                     RTTInfo::from<T>().getStandardName());
+                    }
+
+                    inline void append(Columns &columns, const T &obj) {
+                        throw exception::ILogicError("IColumnType not implemented for " +
+                                                     RTTInfo::from<T>().getStandardName());
+                    }
+
+                    inline void write(IColumnFileWriter &file, Columns &columns) {
+                        throw exception::ILogicError("IColumnType not implemented for " +
+                                                     RTTInfo::from<T>().getStandardName());
+                    }
+
+                    inline void read(IColumnFileReader &file, int64_t group, int64_t column, Columns &columns) {
+                        throw exception::ILogicError("IColumnType not implemented for " +
+                                                     RTTInfo::from<T>().getStandardName());
+                    }
+
+                    inline T get(Columns &columns, size_t i) {
+                        throw exception::ILogicError("IColumnType not implemented for " +
+                                                     RTTInfo::from<T>().getStandardName());
+                    }
+
+                    /*False if the statistics prove that no element of the chunk is in [min, max]*/
+                    inline bool overlaps(IColumnFileReader &file, int64_t group, int64_t column, const T &min,
+                                         const T &max) {
+                        throw exception::ILogicError("IColumnType not implemented for " +
+                                                     RTTInfo::from<T>().getStandardName());
+                    }
+                };
+            }// namespace io
+        }    // namespace core
+    }        // namespace executor
+}// namespace ignis
+
+#include "IColumnType.tcc"
+
+#endif
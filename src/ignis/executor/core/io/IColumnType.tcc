@@ -0,0 +1,289 @@
+
+#include "IColumnType.h"
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+template<typename T>
+struct ignis::executor::core::io::IColumnType<T, typename std::enable_if<std::is_integral<T>::value>::type> {
+    static const bool columnar = true;
+    static const int columns = 1;
+    typedef std::vector<T> Columns;
+
+    inline void kinds(std::vector<int8_t> &kinds) {
+        if (std::is_same<T, bool>::value) {
+            kinds.push_back(IEnumTypes::I_BOOL);
+        } else {
+            const int8_t ints[] = {IEnumTypes::I_I08, IEnumTypes::I_I16, IEnumTypes::I_I32, IEnumTypes::I_I64};
+            kinds.push_back(ints[sizeof(T) == 1 ? 0 : sizeof(T) == 2 ? 1 : sizeof(T) == 4 ? 2 : 3]);
+        }
+    }
+
+    inline void append(Columns &columns, const T &obj) { columns.push_back(obj); }
+
+    inline void write(IColumnFileWriter &file, Columns &columns) {
+        auto &proto = file.chunk();
+        T min = columns[0];
+        T max = columns[0];
+        size_t runs = 1;
+        for (size_t i = 1; i < columns.size(); i++) {
+            if (columns[i] < min) { min = columns[i]; }
+            if (max < columns[i]) { max = columns[i]; }
+            if (columns[i] != columns[i - 1]) { runs++; }
+        }
+        /*Values are stored as differences from min, unsigned arithmetic keeps the order of both signs*/
+        int width = IColumnFile::bitWidth((uint64_t) max - (uint64_t) min);
+        /*A run is a value and a counter, a couple of varints*/
+        if (runs * 4 < (columns.size() * width + 7) / 8) {
+            proto.writeByte(IColumnFile::RLE);
+            proto.writeI64(runs);
+            size_t start = 0;
+            for (size_t i = 1; i <= columns.size(); i++) {
+                if (i == columns.size() || columns[i] != columns[start]) {
+                    proto.writeI64((int64_t) columns[start]);
+                    proto.writeI64(i - start);
+                    start = i;
+                }
+            }
+        } else {
+            std::vector<uint64_t> deltas;
+            deltas.reserve(columns.size());
+            for (size_t i = 0; i < columns.size(); i++) { deltas.push_back((uint64_t) columns[i] - (uint64_t) min); }
+            proto.writeByte(IColumnFile::BIT_PACKED);
+            proto.writeI64((int64_t) min);
+            proto.writeByte(width);
+            proto.writeBinary(IColumnFile::pack(deltas, width));
+        }
+        auto &stats = file.stats();
+        stats.writeI64((int64_t) min);
+        stats.writeI64((int64_t) max);
+    }
+
+    inline void read(IColumnFileReader &file, int64_t group, int64_t column, Columns &columns) {
+        int64_t rows = file.rows(group);
+        auto &proto = file.chunk(group, column);
+        int8_t encoding;
+        proto.readByte(encoding);
+        columns.clear();
+        columns.reserve(rows);
+        if (encoding == IColumnFile::RLE) {
+            int64_t runs, value, count;
+            proto.readI64(runs);
+            for (int64_t r = 0; r < runs; r++) {
+                proto.readI64(value);
+                proto.readI64(count);
+                if (count < 0 || count > rows - (int64_t) columns.size()) {
+                    throw exception::ILogicError("columnar file: run out of the row group");
+                }
+                columns.insert(columns.end(), count, (T) value);
+            }
+        } else if (encoding == IColumnFile::BIT_PACKED) {
+            int64_t min;
+            int8_t width;
+            std::string packed;
+            std::vector<uint64_t> deltas;
+            proto.readI64(min);
+            proto.readByte(width);
+            proto.readBinary(packed);
+            IColumnFile::unpack(packed, width, deltas, rows);
+            for (auto delta : deltas) { columns.push_back((T) ((uint64_t) min + delta)); }
+        } else {
+            throw exception::ILogicError("columnar file: unknown encoding " + std::to_string(encoding));
+        }
+        if ((int64_t) columns.size() != rows) { throw exception::ILogicError("columnar file: missing values"); }
+    }
+
+    inline T get(Columns &columns, size_t i) { return columns[i]; }
+
+    inline bool overlaps(IColumnFileReader &file, int64_t group, int64_t column, const T &min, const T &max) {
+        auto &stats = file.stats(group, column);
+        int64_t smin, smax;
+        stats.readI64(smin);
+        stats.readI64(smax);
+        return !((T) smax < min || max < (T) smin);
+    }
+};
+
+template<typename T>
+struct ignis::executor::core::io::IColumnType<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+    static const bool columnar = true;
+    static const int columns = 1;
+    typedef std::vector<T> Columns;
+
+    inline void kinds(std::vector<int8_t> &kinds) {
+        kinds.push_back(std::is_same<T, float>::value ? IColumnFile::I_FLOAT : (int8_t) IEnumTypes::I_DOUBLE);
+    }
+
+    inline void append(Columns &columns, const T &obj) { columns.push_back(obj); }
+
+    inline void write(IColumnFileWriter &file, Columns &columns) {
+        auto &proto = file.chunk();
+        proto.writeByte(IColumnFile::PLAIN);
+        proto.writeBinary(std::string((const char *) columns.data(), columns.size() * sizeof(T)));
+        /*NaN is never inside a range, it does not need to be in the statistics*/
+        T min = columns[0];
+        T max = columns[0];
+        for (auto &value : columns) {
+            if (value < min || min != min) { min = value; }
+            if (max < value || max != max) { max = value; }
+        }
+        auto &stats = file.stats();
+        stats.writeDouble(min);
+        stats.writeDouble(max);
+    }
+
+    inline void read(IColumnFileReader &file, int64_t group, int64_t column, Columns &columns) {
+        int64_t rows = file.rows(group);
+        auto &proto = file.chunk(group, column);
+        int8_t encoding;
+        std::string plain;
+        proto.readByte(encoding);
+        if (encoding != IColumnFile::PLAIN) {
+            throw exception::ILogicError("columnar file: unknown encoding " + std::to_string(encoding));
+        }
+        proto.readBinary(plain);
+        if (plain.size() != rows * sizeof(T)) { throw exception::ILogicError("columnar file: missing values"); }
+        columns.resize(rows);
+        std::memcpy(columns.data(), plain.data(), plain.size());
+    }
+
+    inline T get(Columns &columns, size_t i) { return columns[i]; }
+
+    inline bool overlaps(IColumnFileReader &file, int64_t group, int64_t column, const T &min, const T &max) {
+        auto &stats = file.stats(group, column);
+        double smin, smax;
+        stats.readDouble(smin);
+        stats.readDouble(smax);
+        return !(smax < min || max < smin);
+    }
+};
+
+template<>
+struct ignis::executor::core::io::IColumnType<std::string> {
+    static const bool columnar = true;
+    static const int columns = 1;
+    typedef std::vector<std::string> Columns;
+
+    inline void kinds(std::vector<int8_t> &kinds) { kinds.push_back(IEnumTypes::I_STRING); }
+
+    inline void append(Columns &columns, const std::string &obj) { columns.push_back(obj); }
+
+    inline void write(IColumnFileWriter &file, Columns &columns) {
+        auto &proto = file.chunk();
+        const std::string *min = &columns[0];
+        const std::string *max = &columns[0];
+        /*Dictionary while the distinct values are at most half of the rows*/
+        std::unordered_map<std::string, uint64_t> ids;
+        std::vector<const std::string *> dictionary;
+        std::vector<uint64_t> indices;
+        bool use_dictionary = columns.size() > 1;
+        for (auto &value : columns) {
+            if (value < *min) { min = &value; }
+            if (*max < value) { max = &value; }
+            if (use_dictionary) {
+                auto entry = ids.emplace(value, dictionary.size());
+                if (entry.second) { dictionary.push_back(&value); }
+                indices.push_back(entry.first->second);
+                use_dictionary = dictionary.size() * 2 <= columns.size();
+            }
+        }
+        if (use_dictionary) {
+            int width = IColumnFile::bitWidth(dictionary.size() - 1);
+            proto.writeByte(IColumnFile::DICTIONARY);
+            proto.writeI64(dictionary.size());
+            for (auto value : dictionary) { proto.writeString(*value); }
+            proto.writeByte(width);
+            proto.writeBinary(IColumnFile::pack(indices, width));
+        } else {
+            proto.writeByte(IColumnFile::PLAIN);
+            for (auto &value : columns) { proto.writeString(value); }
+        }
+        auto &stats = file.stats();
+        stats.writeString(*min);
+        stats.writeString(*max);
+    }
+
+    inline void read(IColumnFileReader &file, int64_t group, int64_t column, Columns &columns) {
+        int64_t rows = file.rows(group);
+        auto &proto = file.chunk(group, column);
+        int8_t encoding;
+        proto.readByte(encoding);
+        columns.clear();
+        if (encoding == IColumnFile::DICTIONARY) {
+            int64_t size;
+            int8_t width;
+            std::string packed;
+            std::vector<uint64_t> indices;
+            proto.readI64(size);
+            std::vector<std::string> dictionary(size);
+            for (auto &value : dictionary) { proto.readString(value); }
+            proto.readByte(width);
+            proto.readBinary(packed);
+            IColumnFile::unpack(packed, width, indices, rows);
+            columns.reserve(rows);
+            for (auto index : indices) {
+                if (index >= dictionary.size()) { throw exception::ILogicError("columnar file: bad dictionary index"); }
+                columns.push_back(dictionary[index]);
+            }
+        } else if (encoding == IColumnFile::PLAIN) {
+            columns.resize(rows);
+            for (auto &value : columns) { proto.readString(value); }
+        } else {
+            throw exception::ILogicError("columnar file: unknown encoding " + std::to_string(encoding));
+        }
+    }
+
+    inline std::string get(Columns &columns, size_t i) { return std::move(columns[i]); }
+
+    inline bool overlaps(IColumnFileReader &file, int64_t group, int64_t column, const std::string &min,
+                         const std::string &max) {
+        auto &stats = file.stats(group, column);
+        std::string smin, smax;
+        stats.readString(smin);
+        stats.readString(smax);
+        return !(smax < min || max < smin);
+    }
+};
+
+template<typename _T1, typename _T2>
+struct ignis::executor::core::io::IColumnType<std::pair<_T1, _T2>> {
+    static const bool columnar = IColumnType<_T1>::columnar && IColumnType<_T2>::columnar;
+    static const int columns = IColumnType<_T1>::columns + IColumnType<_T2>::columns;
+    typedef std::pair<typename IColumnType<_T1>::Columns, typename IColumnType<_T2>::Columns> Columns;
+
+    inline void kinds(std::vector<int8_t> &kinds) {
+        first.kinds(kinds);
+        second.kinds(kinds);
+    }
+
+    inline void append(Columns &columns, const std::pair<_T1, _T2> &obj) {
+        first.append(columns.first, obj.first);
+        second.append(columns.second, obj.second);
+    }
+
+    inline void write(IColumnFileWriter &file, Columns &columns) {
+        first.write(file, columns.first);
+        second.write(file, columns.second);
+    }
+
+    inline void read(IColumnFileReader &file, int64_t group, int64_t column, Columns &columns) {
+        first.read(file, group, column, columns.first);
+        second.read(file, group, column + IColumnType<_T1>::columns, columns.second);
+    }
+
+    inline std::pair<_T1, _T2> get(Columns &columns, size_t i) {
+        return std::pair<_T1, _T2>(first.get(columns.first, i), second.get(columns.second, i));
+    }
+
+    inline bool overlaps(IColumnFileReader &file, int64_t group, int64_t column, const std::pair<_T1, _T2> &min,
+                         const std::pair<_T1, _T2> &max) {
+        throw exception::ILogicError("columnar file: statistics are only kept for single columns");
+    }
+
+private:
+    IColumnType<_T1> first;
+    IColumnType<_T2> second;
+};
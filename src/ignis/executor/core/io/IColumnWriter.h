@@ -0,0 +1,41 @@
+#ifndef IGNIS_ICOLUMNWRITER_H
+#define IGNIS_ICOLUMNWRITER_H
+
+#include "IColumnType.h"
+
+namespace ignis {
+    namespace executor {
+        namespace core {
+            namespace io {
+                template<typename Tp>
+                class IColumnWriter {
+                public:
+                    /*Elements are buffered by columns and written every group_rows elements*/
+                    IColumnWriter(const std::string &path, int8_t compression, int64_t group_rows);
+
+                    IColumnWriter(const std::shared_ptr<transport::ITransport> &file, int8_t compression,
+                                  int64_t group_rows);
+
+                    void write(const Tp &obj);
+
+                    void close();
+
+                private:
+                    static std::vector<int8_t> kinds();
+
+                    void writeGroup();
+
+                    IColumnType<Tp> type;
+                    typename IColumnType<Tp>::Columns columns;
+                    IColumnFileWriter file;
+                    int64_t rows;
+                    int64_t group_rows;
+                };
+            }// namespace io
+        }    // namespace core
+    }        // namespace executor
+}// namespace ignis
+
+#include "IColumnWriter.tcc"
+
+#endif
@@ -0,0 +1,42 @@
+
+#include "IColumnWriter.h"
+
+#define IColumnWriterClass ignis::executor::core::io::IColumnWriter
+
+template<typename Tp>
+IColumnWriterClass<Tp>::IColumnWriter(const std::string &path, int8_t compression, int64_t group_rows)
+    : file(path, compression, kinds()), rows(0), group_rows(group_rows) {}
+
+template<typename Tp>
+IColumnWriterClass<Tp>::IColumnWriter(const std::shared_ptr<transport::ITransport> &file, int8_t compression,
+                                      int64_t group_rows)
+    : file(file, compression, kinds()), rows(0), group_rows(group_rows) {}
+
+template<typename Tp>
+void IColumnWriterClass<Tp>::write(const Tp &obj) {
+    type.append(columns, obj);
+    if (++rows == group_rows) { writeGroup(); }
+}
+
+template<typename Tp>
+void IColumnWriterClass<Tp>::close() {
+    if (rows > 0) { writeGroup(); }
+    file.close();
+}
+
+template<typename Tp>
+std::vector<int8_t> IColumnWriterClass<Tp>::kinds() {
+    std::vector<int8_t> kinds;
+    IColumnType<Tp>().kinds(kinds);
+    return kinds;
+}
+
+template<typename Tp>
+void IColumnWriterClass<Tp>::writeGroup() {
+    type.write(file, columns);
+    file.endGroup(rows);
+    columns = typename IColumnType<Tp>::Columns();
+    rows = 0;
+}
+
+#undef IColumnWriterClass
@@ -0,0 +1,91 @@
+#ifndef IGNIS_IJSONSTREAMREADER_H
+#define IGNIS_IJSONSTREAMREADER_H
+
+#include "IJsonReader.h"
+#include "ignis/executor/api/IWriteIterator.h"
+#include "ignis/executor/core/storage/IMemoryPartition.h"
+#include <rapidjson/reader.h>
+#include <vector>
+
+namespace ignis {
+    namespace executor {
+        namespace core {
+            namespace io {
+                /*SAX handler that builds one element at a time and writes it as soon as it is complete*/
+                template<typename Tp>
+                class IJsonStreamHandler
+                    : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, IJsonStreamHandler<Tp>> {
+                public:
+                    IJsonStreamHandler(api::IWriteIterator<Tp> &out, JsonNode::AllocatorType &allocator, bool array);
+
+                    bool Null();
+
+                    bool Bool(bool b);
+
+                    bool Int(int i);
+
+                    bool Uint(unsigned u);
+
+                    bool Int64(int64_t i);
+
+                    bool Uint64(uint64_t u);
+
+                    bool Double(double d);
+
+                    bool String(const char *str, rapidjson::SizeType length, bool copy);
+
+                    bool Key(const char *str, rapidjson::SizeType length, bool copy);
+
+                    bool StartObject();
+
+                    bool EndObject(rapidjson::SizeType members);
+
+                    bool StartArray();
+
+                    bool EndArray(rapidjson::SizeType elements);
+                private:
+                    bool value(JsonNode &node);
+
+                    bool start(rapidjson::Type type);
+
+                    bool end();
+
+                    api::IWriteIterator<Tp> &out;
+                    JsonNode::AllocatorType &allocator;
+                    IJsonReaderType<Tp> reader;
+                    std::vector<JsonNode> stack;
+                    std::vector<JsonNode> keys;
+                    bool array;
+                    bool opened;
+                };
+
+                /*
+                 * Reads json elements without building the document of the whole input. With array the input must
+                 * be a single array whose items are the elements, otherwise every top-level value is an element, so
+                 * newline delimited json is accepted even if its records are arrays.
+                 */
+                template<typename Tp>
+                class IJsonStreamReader {
+                public:
+                    void operator()(const std::string &path, api::IWriteIterator<Tp> &out, bool array);
+
+                    /*Every top-level value in data is an element*/
+                    void operator()(const char *data, size_t len, api::IWriteIterator<Tp> &out);
+
+                    void operator()(const char *data, size_t len, api::IVector<Tp> &out);
+
+                private:
+                    template<typename Stream>
+                    void parse(Stream &in, api::IWriteIterator<Tp> &out, bool array);
+
+                    rapidjson::Reader reader;
+                    JsonNode::AllocatorType allocator;
+                };
+            }// namespace io
+        }    // namespace core
+    }        // namespace executor
+}// namespace ignis
+
+#include "IJsonStreamReader.tcc"
+
+#endif
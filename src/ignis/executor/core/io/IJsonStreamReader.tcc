@@ -0,0 +1,186 @@
+
+#include "IJsonStreamReader.h"
+#include "ignis/executor/core/exception/IInvalidArgument.h"
+#include "ignis/executor/core/transport/IMappedBuffer.h"
+#include "ignis/executor/core/transport/IPipe.h"
+#include <cstdio>
+#include <rapidjson/error/en.h>
+#include <rapidjson/filereadstream.h>
+#include <rapidjson/memorystream.h>
+
+#define IJsonStreamHandlerClass ignis::executor::core::io::IJsonStreamHandler
+#define IJsonStreamReaderClass ignis::executor::core::io::IJsonStreamReader
+
+template<typename Tp>
+IJsonStreamHandlerClass<Tp>::IJsonStreamHandler(api::IWriteIterator<Tp> &out, JsonNode::AllocatorType &allocator,
+                                                bool array)
+    : out(out), allocator(allocator), array(array), opened(false) {}
+
+template<typename Tp>
+bool IJsonStreamHandlerClass<Tp>::Null() {
+    JsonNode node;
+    return value(node);
+}
+
+template<typename Tp>
+bool IJsonStreamHandlerClass<Tp>::Bool(bool b) {
+    JsonNode node(b);
+    return value(node);
+}
+
+template<typename Tp>
+bool IJsonStreamHandlerClass<Tp>::Int(int i) {
+    JsonNode node(i);
+    return value(node);
+}
+
+template<typename Tp>
+bool IJsonStreamHandlerClass<Tp>::Uint(unsigned u) {
+    JsonNode node(u);
+    return value(node);
+}
+
+template<typename Tp>
+bool IJsonStreamHandlerClass<Tp>::Int64(int64_t i) {
+    JsonNode node(i);
+    return value(node);
+}
+
+template<typename Tp>
+bool IJsonStreamHandlerClass<Tp>::Uint64(uint64_t u) {
+    JsonNode node(u);
+    return value(node);
+}
+
+template<typename Tp>
+bool IJsonStreamHandlerClass<Tp>::Double(double d) {
+    JsonNode node(d);
+    return value(node);
+}
+
+template<typename Tp>
+bool IJsonStreamHandlerClass<Tp>::String(const char *str, rapidjson::SizeType length, bool copy) {
+    JsonNode node(str, length, allocator);
+    return value(node);
+}
+
+template<typename Tp>
+bool IJsonStreamHandlerClass<Tp>::Key(const char *str, rapidjson::SizeType length, bool copy) {
+    keys.emplace_back(str, length, allocator);
+    return true;
+}
+
+template<typename Tp>
+bool IJsonStreamHandlerClass<Tp>::StartObject() {
+    return start(rapidjson::kObjectType);
+}
+
+template<typename Tp>
+bool IJsonStreamHandlerClass<Tp>::EndObject(rapidjson::SizeType members) {
+    return end();
+}
+
+template<typename Tp>
+bool IJsonStreamHandlerClass<Tp>::StartArray() {
+    if (array && !opened && stack.empty()) {
+        opened = true;
+        return true;
+    }
+    return start(rapidjson::kArrayType);
+}
+
+template<typename Tp>
+bool IJsonStreamHandlerClass<Tp>::EndArray(rapidjson::SizeType elements) {
+    if (stack.empty()) { return true; }
+    return end();
+}
+
+template<typename Tp>
+bool IJsonStreamHandlerClass<Tp>::value(JsonNode &node) {
+    if (!stack.empty()) {
+        if (stack.back().IsObject()) {
+            stack.back().AddMember(keys.back(), node, allocator);
+            keys.pop_back();
+        } else {
+            stack.back().PushBack(node, allocator);
+        }
+        return true;
+    }
+    out.write(reader(node));
+    /*Elements are independent, their memory is released once it is large enough to matter*/
+    if (allocator.Size() > transport::IPipe::bufferSize()) { allocator.Clear(); }
+    return true;
+}
+
+template<typename Tp>
+bool IJsonStreamHandlerClass<Tp>::start(rapidjson::Type type) {
+    stack.emplace_back(type);
+    return true;
+}
+
+template<typename Tp>
+bool IJsonStreamHandlerClass<Tp>::end() {
+    JsonNode node(std::move(stack.back()));
+    stack.pop_back();
+    return value(node);
+}
+
+template<typename Tp>
+void IJsonStreamReaderClass<Tp>::operator()(const std::string &path, api::IWriteIterator<Tp> &out, bool array) {
+    auto mapped = transport::IMappedBuffer::map(path);
+    if (mapped) {
+        uint8_t *data;
+        size_t size;
+        mapped->getBuffer(&data, &size);
+        rapidjson::MemoryStream in(reinterpret_cast<const char *>(data), size);
+        parse(in, out, array);
+        return;
+    }
+    std::FILE *file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) { throw exception::IInvalidArgument(path + " cannot be opened"); }
+    std::vector<char> buffer(transport::IPipe::bufferSize());
+    rapidjson::FileReadStream in(file, &buffer[0], buffer.size());
+    try {
+        parse(in, out, array);
+    } catch (...) {
+        std::fclose(file);
+        throw;
+    }
+    std::fclose(file);
+}
+
+template<typename Tp>
+void IJsonStreamReaderClass<Tp>::operator()(const char *data, size_t len, api::IWriteIterator<Tp> &out) {
+    rapidjson::MemoryStream in(data, len);
+    parse(in, out, false);
+}
+
+template<typename Tp>
+void IJsonStreamReaderClass<Tp>::operator()(const char *data, size_t len, api::IVector<Tp> &out) {
+    storage::IMemoryWriteIterator<Tp> it(out);
+    (*this)(data, len, it);
+}
+
+template<typename Tp>
+template<typename Stream>
+void IJsonStreamReaderClass<Tp>::parse(Stream &in, api::IWriteIterator<Tp> &out, bool array) {
+    IJsonStreamHandler<Tp> handler(out, allocator, array);
+    rapidjson::SkipWhitespace(in);
+    if (array && in.Peek() != '[') { throw exception::IInvalidArgument("json is not valid. Array expected"); }
+    /*Each parse reads a single top-level value*/
+    for (int64_t values = 0; in.Peek() != '\0'; values++) {
+        if (array && values > 0) {
+            throw exception::IInvalidArgument("json is not valid. The array must be the only value");
+        }
+        if (!reader.template Parse<rapidjson::kParseIterativeFlag | rapidjson::kParseStopWhenDoneFlag>(in, handler)) {
+            throw exception::IInvalidArgument(std::string("json is not valid. ") +
+                                              rapidjson::GetParseError_En(reader.GetParseErrorCode()) +
+                                              " at offset " + std::to_string(reader.GetErrorOffset()));
+        }
+        rapidjson::SkipWhitespace(in);
+    }
+    allocator.Clear();
+}
+
+#undef IJsonStreamHandlerClass
+#undef IJsonStreamReaderClass
@@ -0,0 +1,48 @@
+#include "IRowFile.h"
+#include "ignis/executor/core/exception/IInvalidArgument.h"
+#include "ignis/executor/core/exception/ILogicError.h"
+#include "ignis/executor/core/transport/IMemoryBuffer.h"
+#include "ignis/executor/core/transport/IPipe.h"
+#include <thrift/protocol/TCompactProtocol.h>
+#include <unistd.h>
+
+using namespace ignis::executor::core::io;
+using namespace ignis::executor::core;
+using apache::thrift::protocol::TCompactProtocol;
+
+std::vector<IRowFile::Block> IRowFile::readIndex(const std::string &path) {
+    std::vector<Block> blocks;
+    if (::access((path + ".index").c_str(), F_OK) != 0) { return blocks; }
+    transport::IFileTransport file(path + ".index", true, false);
+    auto buffer = std::make_shared<transport::IMemoryBuffer>();
+    transport::IPipe::copy(file, *buffer);
+    TCompactProtocol index_proto(buffer);
+    int64_t size;
+    index_proto.readI64(size);
+    if (size < 0) { throw exception::IInvalidArgument(path + ".index is not a valid index"); }
+    blocks.resize(size);
+    for (auto &block : blocks) {
+        index_proto.readI64(block.offset);
+        index_proto.readI64(block.rows);
+    }
+    return blocks;
+}
+
+void IRowFile::writeIndex(const std::string &path, const std::vector<Block> &blocks) {
+    auto buffer = std::make_shared<transport::IMemoryBuffer>();
+    TCompactProtocol index_proto(buffer);
+    index_proto.writeI64(blocks.size());
+    for (auto &block : blocks) {
+        index_proto.writeI64(block.offset);
+        index_proto.writeI64(block.rows);
+    }
+    transport::IFileTransport file(path + ".index", false, true);
+    if (::ftruncate64(file.getFD(), 0) != 0) {
+        throw exception::ILogicError("error: " + path + ".index truncate error");
+    }
+    uint8_t *data;
+    size_t size;
+    buffer->getBuffer(&data, &size);
+    file.write(data, size);
+    file.flush();
+}
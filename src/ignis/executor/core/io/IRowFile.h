@@ -0,0 +1,36 @@
+#ifndef IGNIS_IROWFILE_H
+#define IGNIS_IROWFILE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ignis {
+    namespace executor {
+        namespace core {
+            namespace io {
+                /*
+                 * Row object file. The data file and <name>.header are a disk partition, <name>.index locates its
+                 * blocks. Every block starts after a full flush of the codec, so it can be decoded with the header
+                 * and without the previous blocks. Files saved without index are a single block.
+                 *
+                 * index: blocks | (offset, rows) of every block
+                 */
+                class IRowFile {
+                public:
+                    struct Block {
+                        int64_t offset;
+                        int64_t rows;
+                    };
+
+                    /*Empty if the file has no index*/
+                    static std::vector<Block> readIndex(const std::string &path);
+
+                    static void writeIndex(const std::string &path, const std::vector<Block> &blocks);
+                };
+            }// namespace io
+        }    // namespace core
+    }        // namespace executor
+}// namespace ignis
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef IGNIS_IROWREADER_H
+#define IGNIS_IROWREADER_H
+
+#include "IRowFile.h"
+#include "ignis/executor/api/IWriteIterator.h"
+#include "ignis/executor/core/protocol/IObjectProtocol.h"
+#include "ignis/executor/core/transport/ITransport.h"
+
+namespace ignis {
+    namespace executor {
+        namespace core {
+            namespace io {
+                template<typename Tp>
+                class IRowReader {
+                public:
+                    IRowReader(const std::string &path);
+
+                    int64_t blocks();
+
+                    /*Consecutive blocks are decoded as a single stream, other blocks seek to their offset*/
+                    void readBlock(int64_t block, api::IWriteIterator<Tp> &out);
+
+                private:
+                    /*Returns the elements of the file written in the header*/
+                    int64_t open(int64_t block);
+
+                    std::string path;
+                    std::string header;
+                    std::vector<IRowFile::Block> index;
+                    std::shared_ptr<transport::IFileTransport> file;
+                    std::shared_ptr<protocol::IObjectProtocol> proto;
+                    int64_t next;
+                };
+            }// namespace io
+        }    // namespace core
+    }        // namespace executor
+}// namespace ignis
+
+#include "IRowReader.tcc"
+
+#endif
@@ -0,0 +1,61 @@
+
+#include "IRowReader.h"
+#include "ignis/executor/core/exception/ILogicError.h"
+#include "ignis/executor/core/storage/IRawPartition.h"
+#include "ignis/executor/core/transport/IHeaderTransport.h"
+#include "ignis/executor/core/transport/IMemoryBuffer.h"
+#include "ignis/executor/core/transport/IPipe.h"
+#include "ignis/executor/core/transport/IZlibTransport.h"
+#include <thrift/transport/TBufferTransports.h>
+
+#define IRowReaderClass ignis::executor::core::io::IRowReader
+
+template<typename Tp>
+IRowReaderClass<Tp>::IRowReader(const std::string &path)
+    : path(path), index(IRowFile::readIndex(path)),
+      file(std::make_shared<transport::IFileTransport>(path, true, false)), next(-1) {
+    transport::IFileTransport file_header(path + ".header", true, false);
+    transport::IMemoryBuffer buffer;
+    transport::IPipe::copy(file_header, buffer);
+    header = buffer.getBufferAsString();
+    if (index.empty()) {
+        /*Files saved without index are a single block, its rows are the elements of the header*/
+        IRowFile::Block block;
+        block.offset = 0;
+        block.rows = 0;
+        index.push_back(block);
+        index[0].rows = open(0);
+    }
+}
+
+template<typename Tp>
+int64_t IRowReaderClass<Tp>::blocks() {
+    return index.size();
+}
+
+template<typename Tp>
+void IRowReaderClass<Tp>::readBlock(int64_t block, api::IWriteIterator<Tp> &out) {
+    if (block != next) { open(block); }
+    size_t rows = index[block].rows;
+    storage::IRawReadIterator<Tp> reader(proto, rows);
+    while (reader.hasNext()) { out.write(reader.next()); }
+    next = block + 1;
+}
+
+template<typename Tp>
+int64_t IRowReaderClass<Tp>::open(int64_t block) {
+    if (::lseek64(file->getFD(), index[block].offset, SEEK_SET) != index[block].offset) {
+        throw exception::ILogicError("error: " + path + " seek error");
+    }
+    /*Bytes read ahead by the previous stream are discarded, the block starts after the header*/
+    std::shared_ptr<transport::ITransport> buffered = std::make_shared<apache::thrift::transport::TBufferedTransport>(
+            file, transport::IPipe::bufferSize(), 0);
+    std::shared_ptr<transport::ITransport> header_trans = std::make_shared<transport::IHeaderTransport>(buffered,
+                                                                                                       header);
+    proto = std::make_shared<protocol::IObjectProtocol>(std::make_shared<transport::IZlibTransport>(header_trans));
+    proto->readSerialization();
+    next = block;
+    return storage::IHeader<Tp>().read(*proto);
+}
+
+#undef IRowReaderClass
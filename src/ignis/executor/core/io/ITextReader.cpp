@@ -0,0 +1,94 @@
+#include "ITextReader.h"
+#include "ignis/executor/core/exception/IInvalidArgument.h"
+#include "ignis/executor/core/exception/ILogicError.h"
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace ignis::executor::core::io;
+using namespace ignis::executor::core;
+
+ITextReader::ITextReader(const std::string &path, const std::string &delim, const std::vector<std::string> &exs,
+                         size_t block)
+    : path(path), delim(delim), exs(exs), buffer(std::max<size_t>(block, delim.size() * 2)), offset(0), begin(0),
+      end(0) {
+    fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) { throw exception::IInvalidArgument(path + " cannot be opened"); }
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+}
+
+ITextReader::~ITextReader() { ::close(fd); }
+
+void ITextReader::seek(size_t pos) {
+    offset = pos;
+    begin = end = 0;
+}
+
+bool ITextReader::next(const char *&data, size_t &len) {
+    size_t from = begin;
+    size_t pos;
+    while ((pos = search(from)) == std::string::npos) {
+        if (!fill(from)) {
+            if (begin == end) { return false; }
+            data = &buffer[begin];
+            len = end - begin;
+            begin = end;
+            return true;
+        }
+    }
+    data = &buffer[begin];
+    len = pos - begin;
+    begin = pos + delim.size();
+    return true;
+}
+
+size_t ITextReader::tell() { return offset + begin; }
+
+size_t ITextReader::search(size_t &from) {
+    size_t dsize = delim.size();
+    while (from + dsize <= end) {
+        auto found = (const char *) std::memchr(&buffer[from], delim[0], end - from - dsize + 1);
+        if (found == nullptr) {
+            /*The last bytes can start a delimiter that ends in the next block*/
+            from = end - dsize + 1;
+            break;
+        }
+        size_t pos = found - &buffer[0];
+        if (dsize > 1 && std::memcmp(found + 1, delim.c_str() + 1, dsize - 1) != 0) {
+            from = pos + 1;
+            continue;
+        }
+        size_t delim_end = pos + dsize;
+        bool ignored = false;
+        for (auto &ex : exs) {
+            if (delim_end - begin >= ex.size() &&
+                std::memcmp(&buffer[delim_end - ex.size()], ex.c_str(), ex.size()) == 0) {
+                ignored = true;
+                break;
+            }
+        }
+        if (ignored) {
+            from = delim_end;
+            continue;
+        }
+        return pos;
+    }
+    return std::string::npos;
+}
+
+bool ITextReader::fill(size_t &from) {
+    if (begin > 0) {
+        std::memmove(&buffer[0], &buffer[begin], end - begin);
+        offset += begin;
+        end -= begin;
+        from -= begin;
+        begin = 0;
+    }
+    /*A record larger than the block*/
+    if (end == buffer.size()) { buffer.resize(buffer.size() * 2); }
+    auto bytes = ::pread64(fd, &buffer[end], buffer.size() - end, offset + end);
+    if (bytes < 0) { throw exception::ILogicError(path + " read error"); }
+    end += bytes;
+    return bytes > 0;
+}
@@ -0,0 +1,51 @@
+#ifndef IGNIS_ITEXTREADER_H
+#define IGNIS_ITEXTREADER_H
+
+#include <string>
+#include <vector>
+
+namespace ignis {
+    namespace executor {
+        namespace core {
+            namespace io {
+                /*
+                 * Splits a file in records separated by a delimiter. The file is read in large blocks and delimiters
+                 * are located with memchr over the block. A delimiter is ignored when the record up to its end finishes
+                 * with one of the exceptions, each exception must end with the delimiter.
+                 */
+                class ITextReader {
+                public:
+                    ITextReader(const std::string &path, const std::string &delim,
+                                const std::vector<std::string> &exs = {}, size_t block = 1024 * 1024);
+
+                    virtual ~ITextReader();
+
+                    /*Next records start at pos*/
+                    void seek(size_t pos);
+
+                    /*Returns false at the end of the file, data is valid until the next call*/
+                    bool next(const char *&data, size_t &len);
+
+                    /*Position after the last record and its delimiter*/
+                    size_t tell();
+
+                private:
+                    size_t search(size_t &from);
+
+                    bool fill(size_t &from);
+
+                    std::string path;
+                    std::string delim;
+                    std::vector<std::string> exs;
+                    std::vector<char> buffer;
+                    int fd;
+                    size_t offset;
+                    size_t begin;
+                    size_t end;
+                };
+            }// namespace io
+        }    // namespace core
+    }        // namespace executor
+}// namespace ignis
+
+#endif
@@ -1,5 +1,7 @@
 
 #include "IExecutorServerModule.h"
+#include "ignis/executor/core/transport/IMappedBuffer.h"
+#include "ignis/executor/core/transport/IPipe.h"
 #include "ignis/executor/core/transport/IZlibTransport.h"
 #include <thrift/concurrency/ThreadFactory.h>
 #include <thrift/protocol/TCompactProtocol.h>
@@ -41,6 +43,9 @@ void IExecutorServerModule::start(const std::map<std::string, std::string> &prop
     IGNIS_RPC_TRY()
     executor_data->getContext().props().insert(properties.begin(), properties.end());
     executor_data->setCores(executor_data->getProperties().cores());
+    transport::ICodec::setThreads(executor_data->getProperties().codecThreads());
+    transport::IPipe::setBufferSize(executor_data->getProperties().partitionBuffer());
+    transport::IMappedBuffer::setMinSize(executor_data->getProperties().partitionMmap());
 
     for (auto &entry : env) { setenv(entry.first.c_str(), entry.second.c_str(), 1); }
 
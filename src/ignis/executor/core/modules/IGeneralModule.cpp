@@ -115,13 +115,21 @@ void IGeneralModule::union2(const std::string &other, const bool preserveOrder,
 
 void IGeneralModule::join(const std::string &other, const int64_t numPartitions) {
     IGNIS_RPC_TRY()
-    typeFromPartition()->join(reduce_impl, other, numPartitions);
+    if (executor_data->getProperties().joinType() == "merge") {
+        typeFromPartition()->mergeJoin(sort_impl, other, numPartitions);
+    } else {
+        typeFromPartition()->join(reduce_impl, other, numPartitions);
+    }
     IGNIS_RPC_CATCH()
 }
 
 void IGeneralModule::join3(const std::string &other, const int64_t numPartitions, const rpc::ISource &src) {
     IGNIS_RPC_TRY()
-    typeFromSource(src)->join(reduce_impl, other, numPartitions);
+    if (executor_data->getProperties().joinType() == "merge") {
+        typeFromSource(src)->mergeJoin(sort_impl, other, numPartitions);
+    } else {
+        typeFromSource(src)->join(reduce_impl, other, numPartitions);
+    }
     IGNIS_RPC_CATCH()
 }
 
@@ -203,7 +211,7 @@ void IGeneralModule::aggregateByKey4(const rpc::ISource &zero, const rpc::ISourc
     IGNIS_RPC_TRY()
     executor_data->loadLibrary(zero)->general_action->zero(reduce_impl);
     executor_data->loadLibrary(seqOp)->key->aggregateByKey(reduce_impl, numPartitions, false);
-    executor_data->loadLibrary(combOp)->key->reduceByKey(reduce_impl, numPartitions, false);
+    executor_data->loadLibrary(combOp)->key->mergeByKey(reduce_impl);
     IGNIS_RPC_CATCH()
 }
 
@@ -3,6 +3,7 @@
 #define IGNIS_IBASEIMPL_H
 
 #include "ignis/executor/core/IExecutorData.h"
+#include "ignis/executor/core/IHashTable.h"
 #include "ignis/executor/core/ILog.h"
 #include "ignis/executor/core/IMpi.h"
 #include "ignis/executor/core/exception/IInvalidArgument.h"
@@ -31,12 +32,29 @@ namespace ignis {
                     protected:
                         std::shared_ptr<IExecutorData> executor_data;
 
+                        template<typename Tp, typename Function>
+                        inline void readBatches(storage::IPartition<Tp> &part, Function f);
+
+                        /*Evenly spaced elements of each partition*/
+                        template<typename Tp>
+                        std::shared_ptr<storage::IMemoryPartition<Tp>>
+                        selectSamples(storage::IPartitionGroup<Tp> &group, int64_t samples);
+
                     private:
+                        template<typename Tp>
+                        std::shared_ptr<storage::IMemoryPartition<Tp>>
+                        selectMemorySamples(storage::IPartitionGroup<Tp> &group, int64_t samples);
+
                         template<typename Tp>
                         void exchange_sync(storage::IPartitionGroup<Tp>& in, storage::IPartitionGroup<Tp>& out);
 
+                        /*Non-blocking messages, partitions are serialized and deserialized while others are in flight*/
                         template<typename Tp>
                         void exchange_async(storage::IPartitionGroup<Tp>& in, storage::IPartitionGroup<Tp>& out);
+
+                        /*All partitions are serialized by destination and sent with a single Alltoallv*/
+                        template<typename Tp>
+                        void exchange_alltoall(storage::IPartitionGroup<Tp>& in, storage::IPartitionGroup<Tp>& out);
                     };
                 }// namespace impl
             }    // namespace modules
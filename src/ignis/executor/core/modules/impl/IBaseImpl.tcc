@@ -1,6 +1,11 @@
 
 #include "IBaseImpl.h"
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <list>
+#include <mutex>
 
 #define IBaseImplClass ignis::executor::core::modules::impl::IBaseImpl
 
@@ -16,10 +21,14 @@ void IBaseImplClass::exchange(storage::IPartitionGroup<Tp> &in, storage::IPartit
     }
     auto type = executor_data->getProperties().exchangeType();
     bool sync;
+    bool alltoall = false;
     if (type == "sync") {
         sync = true;
     } else if (type == "async") {
         sync = false;
+    } else if (type == "alltoall") {
+        sync = true;
+        alltoall = true;
     } else {
         IGNIS_LOG(info) << "Base: detecting exchange type";
         int64_t data[2] = {in.partitions(), 0};
@@ -34,9 +43,14 @@ void IBaseImplClass::exchange(storage::IPartitionGroup<Tp> &in, storage::IPartit
             sync = n_zero < (n / executors);
         }
         executor_data->mpi().native().Bcast(&sync, 1, MPI::BOOL, 0);
+        /*A collective per partition is dominated by latency, disk partitions only send their paths*/
+        alltoall = sync && in.partitions() > executors && in[0]->type() != storage::IDiskPartition<Tp>::TYPE;
     }
 
-    if (sync) {
+    if (alltoall) {
+        IGNIS_LOG(info) << "Base: using alltoall exchange";
+        exchange_alltoall(in, out);
+    } else if (sync) {
         IGNIS_LOG(info) << "Base: using synchronous exchange";
         exchange_sync(in, out);
     } else {
@@ -45,6 +59,81 @@ void IBaseImplClass::exchange(storage::IPartitionGroup<Tp> &in, storage::IPartit
     }
 }
 
+template<typename Tp, typename Function>
+inline void IBaseImplClass::readBatches(storage::IPartition<Tp> &part, Function f) {
+    /*Elements are owned by the batch, f can move them*/
+    api::IVector<Tp> batch(std::max<int64_t>(1, std::min<int64_t>(part.size(), 256)));
+    auto data = reinterpret_cast<Tp *>(&batch[0]);
+    auto reader = part.readIterator();
+    int64_t n;
+    while ((n = reader->readBatch(data, batch.size())) > 0) {
+        for (int64_t i = 0; i < n; i++) { f(data[i]); }
+    }
+}
+
+template<typename Tp>
+std::shared_ptr<ignis::executor::core::storage::IMemoryPartition<Tp>>
+IBaseImplClass::selectSamples(storage::IPartitionGroup<Tp> &group, int64_t samples) {
+    if (executor_data->getPartitionTools().isMemory(group)) { return selectMemorySamples(group, samples); }
+    auto result = executor_data->getPartitionTools().newMemoryPartition<Tp>();
+    auto writer = result->writeIterator();
+    IGNIS_OMP_EXCEPTION_INIT()
+#pragma omp parallel
+    {
+        IGNIS_OMP_TRY()
+#pragma omp for schedule(dynamic)
+        for (int64_t p = 0; p < group.partitions(); p++) {
+            if (group[p]->size() < samples) {
+                group[p]->copyTo(*result);
+                writer = result->writeIterator();
+                continue;
+            }
+
+            auto skip = (group[p]->size() - samples) / (samples + 1);
+            auto rem = (group[p]->size() - samples) % (samples + 1);
+            auto reader = group[p]->readIterator();
+            for (int64_t n = 0; n < samples; n++) {
+                for (int64_t i = 0; i < skip; i++) {
+                    reader->next();
+                }
+                if (n < rem) { reader->next(); }
+#pragma omp critical
+                { writer->write(reader->next()); }
+            }
+        }
+        IGNIS_OMP_CATCH()
+    }
+    IGNIS_OMP_EXCEPTION_END()
+    return result;
+}
+
+template<typename Tp>
+std::shared_ptr<ignis::executor::core::storage::IMemoryPartition<Tp>>
+IBaseImplClass::selectMemorySamples(storage::IPartitionGroup<Tp> &group, int64_t samples) {
+    auto result = executor_data->getPartitionTools().newMemoryPartition<Tp>();
+    auto writer = result->writeIterator();
+    auto &men_writer = executor_data->getPartitionTools().toMemory(*writer);
+
+    for (int64_t p = 0; p < group.partitions(); p++) {
+        if (group[p]->size() < samples) {
+            auto &men_part = executor_data->getPartitionTools().toMemory(*(group[p]));
+            for (auto &elem : men_part) { men_writer.write(elem); }
+            continue;
+        }
+
+        auto skip = (group[p]->size() - samples) / (samples + 1);
+        auto rem = (group[p]->size() - samples) % (samples + 1);
+        auto &part = executor_data->getPartitionTools().toMemory(*group[p]);
+        auto pos = skip + (rem > 0 ? 1 : 0);
+        for (int64_t n = 0; n < samples; n++) {
+            men_writer.write(part[pos++]);
+            pos += skip;
+            if (n < rem - 1) { pos++; }
+        }
+    }
+    return result;
+}
+
 template<typename Tp>
 void IBaseImplClass::exchange_sync(storage::IPartitionGroup<Tp> &in, storage::IPartitionGroup<Tp> &out) {
     auto executors = executor_data->mpi().executors();
@@ -98,104 +187,383 @@ void IBaseImplClass::exchange_sync(storage::IPartitionGroup<Tp> &in, storage::IP
 
 template<typename Tp>
 void IBaseImplClass::exchange_async(storage::IPartitionGroup<Tp> &in, storage::IPartitionGroup<Tp> &out) {
-    auto executors = executor_data->mpi().executors();
-    auto rank = executor_data->mpi().rank();
-    auto numPartitions = in.partitions();
+    auto &comm = executor_data->mpi().native();
+    int64_t executors = executor_data->mpi().executors();
+    int64_t rank = executor_data->mpi().rank();
+    int64_t numPartitions = in.partitions();
     int64_t block = numPartitions / executors;
     int64_t remainder = numPartitions % executors;
-    std::vector<std::pair<int64_t, int64_t>> ranges;
-    std::vector<int64_t> queue;
+    auto first = [&](int64_t e) { return e * block + std::min(e, remainder); };
+    auto count = [&](int64_t e) { return block + (e < remainder ? 1 : 0); };
+    int64_t local_first = first(rank);
+    int64_t local = count(rank);
+    auto compression = executor_data->getProperties().msgCompression();
+    executor_data->enableMpiCores();
+    int64_t mpiCores = executor_data->getMpiCores();
+    /*Serialized partitions waiting to be sent or in flight*/
+    int64_t window = std::max<int64_t>(2, mpiCores * 2);
+    int64_t chunk = executor_data->mpi().chunkSize();
+    /*Without other threads, the tasks are run while waiting for messages*/
+    bool helpers = mpiCores > 1;
 
-    int64_t init, end;
-    for (int64_t i = 0; i < executors; i++) {
-        if (i < remainder) {
-            init = (block + 1) * i;
-            end = init + block + 1;
-        } else {
-            init = (block + 1) * remainder + block * (i - remainder);
-            end = init + block;
+    /*Empty partitions are not sent, receivers only wait for the others*/
+    std::vector<char> full(numPartitions, 0), rcv_full(executors * local, 0);
+    std::vector<int64_t> target(numPartitions);
+    std::vector<int> scounts(executors), sdispls(executors), rcounts(executors, local), rdispls(executors);
+    for (int64_t e = 0; e < executors; e++) {
+        for (int64_t p = first(e); p < first(e) + count(e); p++) {
+            target[p] = e;
+            full[p] = e != rank && !in[p]->empty();
         }
-        ranges.emplace_back(init, end);
+        scounts[e] = count(e);
+        sdispls[e] = first(e);
+        rdispls[e] = e * local;
     }
+    comm.Alltoallv(full.data(), scounts.data(), sdispls.data(), MPI::BYTE, rcv_full.data(), rcounts.data(),
+                   rdispls.data(), MPI::BYTE);
 
-    int64_t m = executors % 2 == 0 ? executors : executors + 1;
-    int64_t id = 0;
-    int64_t id2 = m * m - 2;
-    for (int64_t i = 0; i < m - 1; i++) {
-        if (rank == id % (m - 1)) { queue.push_back(m - 1); }
-        if (rank == m - 1) { queue.push_back(id % (m - 1)); }
-        id += 1;
-        for (int64_t j = 1; j < m / 2; j++) {
-            if (rank == id % (m - 1)) { queue.push_back(id2 % (m - 1)); }
-            if (rank == id2 % (m - 1)) { queue.push_back(id % (m - 1)); }
-            id += 1;
-            id2 -= 1;
+    /*Interleave targets so that all executors receive from the first messages*/
+    std::vector<int64_t> sends;
+    for (int64_t k = 0; k < block + 1; k++) {
+        for (int64_t d = 1; d < executors; d++) {
+            int64_t e = (rank + d) % executors;
+            if (k < count(e) && full[first(e) + k]) { sends.push_back(first(e) + k); }
         }
     }
+    int64_t expected = 0;
+    for (auto f : rcv_full) { expected += f; }
 
-    executor_data->enableMpiCores();
-    int64_t mpiCores = executor_data->getMpiCores();
-
-    std::vector<bool> ignores(queue.size(), false);
+    std::vector<std::shared_ptr<transport::IMemoryBuffer>> buffers(numPartitions);
+    std::vector<int64_t> sizes(numPartitions, 0);
+    std::vector<std::atomic<bool>> ready(numPartitions);
+    for (auto &r : ready) { r = false; }
+    /*A failed task stops the exchange, the master is woken to cancel the pending messages*/
+    std::atomic<bool> failed(false);
+    std::mutex ready_mutex;
+    std::condition_variable ready_cv;
+    std::vector<std::shared_ptr<transport::IMemoryBuffer>> rcv_buffers(executors * local);
+    std::vector<int64_t> rcv_sizes(executors * local, 0);
+    std::vector<std::shared_ptr<storage::IPartition<Tp>>> pieces(executors * local);
 
     IGNIS_OMP_EXCEPTION_INIT()
 #pragma omp parallel num_threads(mpiCores)
     {
-        IGNIS_OMP_TRY()
-#pragma omp for schedule(static)
-        for (int64_t i = 0; i < queue.size(); i++) {
-            int64_t other = queue[i];
-            bool ignore = true;
-            bool ignore_other;
-            if (other == executors) { continue; }
-            for (int64_t j = ranges[other].first; j < ranges[other].second; j++) { ignore = ignore && in[j]->empty(); }
-            executor_data->mpi().native().Sendrecv(&ignore, 1, MPI::BOOL, other, 0, &ignore_other, 1, MPI::BOOL, other,
-                                                   0);
-            if(ignore && ignore_other){
-                ignores[i] = true;
-                for (int64_t j = ranges[other].first; j < ranges[other].second; j++) {
-                    in[j].reset();
+#pragma omp master
+        {
+            IGNIS_OMP_TRY()
+            /*Only this thread uses mpi, the others serialize and deserialize the partitions as tasks*/
+            std::vector<std::vector<MPI::Request>> send_reqs(numPartitions);
+            std::vector<MPI::Request> size_reqs(executors * local);
+            std::vector<std::vector<MPI::Request>> rcv_reqs(executors * local);
+            auto done = [](std::vector<MPI::Request> &reqs) {
+                for (auto &req : reqs) {
+                    if (!req.Test()) { return false; }
                 }
+                return true;
+            };
+            auto cancel = [](MPI::Request &req) {
+                if (req == MPI::REQUEST_NULL) { return; }
+                req.Cancel();
+                req.Wait();
+            };
+            std::vector<int64_t> cursor(executors, 0);
+            std::list<int64_t> flight;
+            std::list<int64_t> receiving;
+            int64_t spawned = 0, sent = 0, completed = 0, received = 0;
+
+            for (int64_t k = 0; k < executors * local; k++) {
+                if (rcv_full[k]) { size_reqs[k] = comm.Irecv(&rcv_sizes[k], 1, MPI::LONG, k / local, 0); }
             }
-        }
 
-        for (int64_t i = 0; i < queue.size(); i++) {
-            int64_t other = queue[i];
-            if (ignores[i] || other == executors) { continue; }
-            int64_t other_part = ranges[other].first;
-            int64_t other_end = ranges[other].second;
-            int64_t me_part = ranges[rank].first;
-            int64_t me_end = ranges[rank].second;
-            int64_t its = std::max(other_end - other_part, me_end - me_part);
+            while (!failed && (completed < (int64_t) sends.size() || received < expected)) {
+                bool progress = false;
+                while (spawned < (int64_t) sends.size() && spawned - completed < window) {
+                    int64_t p = sends[spawned++];
+#pragma omp task firstprivate(p)
+                    {
+                        IGNIS_OMP_TRY()
+                        buffers[p] = std::make_shared<transport::IMemoryBuffer>(in[p]->bytes());
+                        in[p]->write((std::shared_ptr<transport::ITransport> &) buffers[p], compression);
+                        sizes[p] = buffers[p]->writeEnd();
+                        in[p].reset();
+                        ready[p] = true;
+                        IGNIS_OMP_CATCH()
+                        if (!ready[p]) { failed = true; }
+                        { std::lock_guard<std::mutex> lock(ready_mutex); }
+                        ready_cv.notify_one();
+                    }
+                }
+
+                /*Messages to the same executor are matched in the order they are sent*/
+                while (!failed && sent < spawned && ready[sends[sent]]) {
+                    int64_t p = sends[sent++];
+                    uint8_t *ptr;
+                    size_t sz;
+                    buffers[p]->getBuffer(&ptr, &sz);
+                    send_reqs[p].push_back(comm.Isend(&sizes[p], 1, MPI::LONG, target[p], 0));
+                    for (int64_t pos = 0; pos < (int64_t) sz; pos += chunk) {
+                        send_reqs[p].push_back(comm.Isend(ptr + pos, (int) std::min<int64_t>(chunk, sz - pos),
+                                                          MPI::BYTE, target[p], 1));
+                    }
+                    flight.push_back(p);
+                    progress = true;
+                }
 
-#pragma omp for schedule(static, 1)
-            for (int64_t j = 0; j < its; j++) {
-                me_part = ranges[rank].first + j;
-                other_part = ranges[other].first + j;
-                if (other_part >= other_end || me_part >= me_end) {
-                    if (other_part >= other_end) {
-                        executor_data->mpi().recv(*in[me_part], other, 0);
-                    } else if (me_part >= me_end) {
-                        executor_data->mpi().send(*in[other_part], other, 0);
+                for (auto it = flight.begin(); it != flight.end();) {
+                    if (done(send_reqs[*it])) {
+                        buffers[*it].reset();
+                        completed++;
+                        it = flight.erase(it);
+                        progress = true;
                     } else {
-                        continue;
+                        it++;
+                    }
+                }
+
+                for (int64_t e = 0; e < executors; e++) {
+                    while (cursor[e] < local && (int64_t) receiving.size() < window) {
+                        int64_t k = e * local + cursor[e];
+                        if (!rcv_full[k]) {
+                            cursor[e]++;
+                            continue;
+                        }
+                        if (!size_reqs[k].Test()) { break; }
+                        rcv_buffers[k] = std::make_shared<transport::IMemoryBuffer>(rcv_sizes[k]);
+                        auto ptr = rcv_buffers[k]->getWritePtr(rcv_sizes[k]);
+                        for (int64_t pos = 0; pos < rcv_sizes[k]; pos += chunk) {
+                            rcv_reqs[k].push_back(comm.Irecv(ptr + pos, (int) std::min(chunk, rcv_sizes[k] - pos),
+                                                             MPI::BYTE, e, 1));
+                        }
+                        receiving.push_back(k);
+                        cursor[e]++;
+                        progress = true;
+                    }
+                }
+
+                for (auto it = receiving.begin(); it != receiving.end();) {
+                    if (done(rcv_reqs[*it])) {
+                        int64_t k = *it;
+#pragma omp task firstprivate(k)
+                        {
+                            bool ok = false;
+                            IGNIS_OMP_TRY()
+                            rcv_buffers[k]->wroteBytes(rcv_sizes[k]);
+                            pieces[k] = executor_data->getPartitionTools().newPartition(*in[local_first + k % local]);
+                            pieces[k]->read((std::shared_ptr<transport::ITransport> &) rcv_buffers[k]);
+                            rcv_buffers[k].reset();
+                            ok = true;
+                            IGNIS_OMP_CATCH()
+                            if (!ok) {
+                                failed = true;
+                                { std::lock_guard<std::mutex> lock(ready_mutex); }
+                                ready_cv.notify_one();
+                            }
+                        }
+                        received++;
+                        it = receiving.erase(it);
+                        progress = true;
+                    } else {
+                        it++;
+                    }
+                }
+
+                if (!progress) {
+                    if (!helpers) {
+#pragma omp taskwait
+                    } else if (sent < spawned) {
+                        /*The next message in send order is being serialized*/
+                        std::unique_lock<std::mutex> lock(ready_mutex);
+                        ready_cv.wait(lock, [&] { return ready[sends[sent]] || failed; });
                     }
-                } else {
-                    executor_data->mpi().sendRcv(*in[other_part], *in[me_part], other, 0);
                 }
-                in[other_part].reset();
             }
+            if (failed) {
+                /*The peers will not receive the remaining messages, the exception is thrown after the tasks end*/
+                for (auto &reqs : send_reqs) {
+                    for (auto &req : reqs) { cancel(req); }
+                }
+                for (auto &req : size_reqs) { cancel(req); }
+                for (auto &reqs : rcv_reqs) {
+                    for (auto &req : reqs) { cancel(req); }
+                }
+            }
+#pragma omp taskwait
+            IGNIS_OMP_CATCH()
+        }
+    }
+    IGNIS_OMP_EXCEPTION_END()
+
+    /*Pieces are joined in rank order like a gather*/
+#pragma omp parallel
+    {
+        IGNIS_OMP_TRY()
+#pragma omp for schedule(dynamic)
+        for (int64_t j = 0; j < local; j++) {
+            auto &own = in[local_first + j];
+            auto part = executor_data->getPartitionTools().newPartition(*own);
+            for (int64_t e = 0; e < executors; e++) {
+                if (e == rank) {
+                    own->moveTo(*part);
+                } else if (pieces[e * local + j]) {
+                    pieces[e * local + j]->moveTo(*part);
+                    pieces[e * local + j].reset();
+                }
+            }
+            part->fit();
+            own = part;
         }
         IGNIS_OMP_CATCH()
     }
     IGNIS_OMP_EXCEPTION_END()
 
-    for (int64_t i = 0; i < numPartitions; i++) {
-        if (in[i]) {
-            in[i]->fit();
-            out.add(in[i]);
+    for (int64_t j = 0; j < local; j++) { out.add(in[local_first + j]); }
+    in.clear();
+}
+
+template<typename Tp>
+void IBaseImplClass::exchange_alltoall(storage::IPartitionGroup<Tp> &in, storage::IPartitionGroup<Tp> &out) {
+    auto &comm = executor_data->mpi().native();
+    int64_t executors = executor_data->mpi().executors();
+    int64_t rank = executor_data->mpi().rank();
+    int64_t numPartitions = in.partitions();
+    int64_t block = numPartitions / executors;
+    int64_t remainder = numPartitions % executors;
+    auto first = [&](int64_t e) { return e * block + std::min(e, remainder); };
+    auto count = [&](int64_t e) { return block + (e < remainder ? 1 : 0); };
+    int64_t local_first = first(rank);
+    int64_t local = count(rank);
+    auto compression = executor_data->getProperties().msgCompression();
+
+    /*Partitions are already grouped by target, own partitions are not serialized*/
+    std::vector<std::shared_ptr<transport::IMemoryBuffer>> buffers(numPartitions);
+    std::vector<int64_t> sizes(numPartitions, 0);
+    IGNIS_OMP_EXCEPTION_INIT()
+#pragma omp parallel
+    {
+        IGNIS_OMP_TRY()
+#pragma omp for schedule(dynamic)
+        for (int64_t p = 0; p < numPartitions; p++) {
+            if (p >= local_first && p < local_first + local) { continue; }
+            buffers[p] = std::make_shared<transport::IMemoryBuffer>(in[p]->bytes());
+            in[p]->write((std::shared_ptr<transport::ITransport> &) buffers[p], compression);
+            sizes[p] = buffers[p]->writeEnd();
+            in[p].reset();
+        }
+        IGNIS_OMP_CATCH()
+    }
+    IGNIS_OMP_EXCEPTION_END()
+
+    std::vector<int64_t> rcv_sizes(executors * local, 0);
+    std::vector<int> scounts(executors), sdispls(executors), rcounts(executors, local), rdispls(executors);
+    for (int64_t e = 0; e < executors; e++) {
+        scounts[e] = count(e);
+        sdispls[e] = first(e);
+        rdispls[e] = e * local;
+    }
+    comm.Alltoallv(sizes.data(), scounts.data(), sdispls.data(), MPI::LONG, rcv_sizes.data(), rcounts.data(),
+                   rdispls.data(), MPI::LONG);
+
+    std::vector<int64_t> send_bytes(executors, 0), rcv_bytes(executors, 0), rcv_displs(executors + 1, 0);
+    int64_t max_bytes = 0;
+    for (int64_t e = 0; e < executors; e++) {
+        for (int64_t p = first(e); p < first(e) + count(e); p++) { send_bytes[e] += sizes[p]; }
+        for (int64_t j = 0; j < local; j++) { rcv_bytes[e] += rcv_sizes[e * local + j]; }
+        rcv_displs[e + 1] = rcv_displs[e] + rcv_bytes[e];
+        max_bytes = std::max(max_bytes, std::max(send_bytes[e], rcv_bytes[e]));
+    }
+    comm.Allreduce(MPI::IN_PLACE, &max_bytes, 1, MPI::LONG, MPI::MAX);
+
+    /*Partition buffers are copied to a staging buffer of at most chunk bytes per executor and released once sent,
+     * counts and displacements are int so larger exchanges are sent in rounds*/
+    int64_t limit = std::numeric_limits<int>::max();
+    int64_t chunk = std::min(executor_data->mpi().chunkSize(), limit / executors);
+    int64_t memory = executor_data->getProperties().exchangeMemory();
+    if (memory > 0) { chunk = std::min(chunk, std::max<int64_t>(1, memory / (2 * executors))); }
+    chunk = std::max<int64_t>(1, std::min(chunk, max_bytes));
+    int64_t rounds = (max_bytes + chunk - 1) / chunk;
+    if (rounds > 1) { IGNIS_LOG(info) << "Base: alltoall exchange in " << rounds << " rounds"; }
+
+    std::vector<uint8_t> rcv_buffer(rcv_displs.back());
+    std::vector<uint8_t> send_stage(chunk * executors);
+    std::vector<uint8_t> rcv_stage(rounds > 1 ? chunk * executors : 0);
+    std::vector<int64_t> cursor(executors), cursor_pos(executors, 0);
+    for (int64_t e = 0; e < executors; e++) { cursor[e] = first(e); }
+    std::vector<int> bscounts(executors), bsdispls(executors), brcounts(executors), brdispls(executors);
+    for (int64_t r = 0; r < rounds; r++) {
+        int64_t pos = r * chunk;
+        for (int64_t e = 0; e < executors; e++) {
+            bscounts[e] = (int) std::max<int64_t>(0, std::min(chunk, send_bytes[e] - pos));
+            brcounts[e] = (int) std::max<int64_t>(0, std::min(chunk, rcv_bytes[e] - pos));
+            bsdispls[e] = (int) (e * chunk);
+            brdispls[e] = (int) (rounds > 1 ? e * chunk : rcv_displs[e]);
+            uint8_t *dest = send_stage.data() + bsdispls[e];
+            int64_t left = bscounts[e];
+            while (left > 0) {
+                int64_t p = cursor[e];
+                if (cursor_pos[e] == sizes[p]) {
+                    buffers[p].reset();
+                    cursor[e]++;
+                    cursor_pos[e] = 0;
+                    continue;
+                }
+                uint8_t *ptr;
+                size_t sz;
+                buffers[p]->getBuffer(&ptr, &sz);
+                int64_t n = std::min(left, sizes[p] - cursor_pos[e]);
+                std::copy(ptr + cursor_pos[e], ptr + cursor_pos[e] + n, dest);
+                dest += n;
+                left -= n;
+                cursor_pos[e] += n;
+            }
+        }
+        auto rcv = rounds > 1 ? rcv_stage.data() : rcv_buffer.data();
+        comm.Alltoallv(send_stage.data(), bscounts.data(), bsdispls.data(), MPI::BYTE, rcv, brcounts.data(),
+                       brdispls.data(), MPI::BYTE);
+        if (rounds > 1) {
+            for (int64_t e = 0; e < executors; e++) {
+                std::copy(rcv_stage.data() + brdispls[e], rcv_stage.data() + brdispls[e] + brcounts[e],
+                          rcv_buffer.data() + rcv_displs[e] + pos);
+            }
+        }
+    }
+    buffers.clear();
+    std::vector<uint8_t>().swap(send_stage);
+    std::vector<uint8_t>().swap(rcv_stage);
+
+    /*Received partitions are read from views of the receive buffer, in rank order like a gather*/
+    std::vector<int64_t> rcv_offsets(executors * local);
+    for (int64_t e = 0; e < executors; e++) {
+        int64_t offset = rcv_displs[e];
+        for (int64_t j = 0; j < local; j++) {
+            rcv_offsets[e * local + j] = offset;
+            offset += rcv_sizes[e * local + j];
         }
     }
+
+#pragma omp parallel
+    {
+        IGNIS_OMP_TRY()
+#pragma omp for schedule(dynamic)
+        for (int64_t j = 0; j < local; j++) {
+            auto &own = in[local_first + j];
+            auto part = executor_data->getPartitionTools().newPartition(*own);
+            for (int64_t e = 0; e < executors; e++) {
+                if (e == rank) {
+                    own->moveTo(*part);
+                } else if (rcv_sizes[e * local + j] > 0) {
+                    auto view = std::make_shared<transport::IMemoryBuffer>(
+                            rcv_buffer.data() + rcv_offsets[e * local + j], rcv_sizes[e * local + j]);
+                    part->read((std::shared_ptr<transport::ITransport> &) view);
+                }
+            }
+            part->fit();
+            own = part;
+        }
+        IGNIS_OMP_CATCH()
+    }
+    IGNIS_OMP_EXCEPTION_END()
+
+    for (int64_t j = 0; j < local; j++) { out.add(in[local_first + j]); }
     in.clear();
 }
 
@@ -59,6 +59,7 @@ void ICommImpl::destroyGroup(const std::string &name) {
 
     auto entry = groups.find(name);
     if (entry != groups.end()) {
+        executor_data->releaseMpiGroup(entry->second);
         entry->second.Free();
         groups.erase(entry);
     }
@@ -67,7 +68,10 @@ void ICommImpl::destroyGroup(const std::string &name) {
 
 void ICommImpl::destroyGroups() {
     IGNIS_TRY()
-    for (auto &elem : groups) { elem.second.Free(); }
+    for (auto &elem : groups) {
+        executor_data->releaseMpiGroup(elem.second);
+        elem.second.Free();
+    }
     groups.clear();
     executor_data->destroyMpiGroup();
     IGNIS_CATCH()
@@ -110,6 +114,7 @@ MPI::Intracomm ICommImpl::joinToGroupImpl(const std::string &id, bool leader) {
         intercomm = comm.Connect(port, MPI::INFO_NULL, 0);
     }
     comm1 = intercomm.Merge(leader ? 0 : 1);
+    executor_data->mpi().clearMsgOpt(intercomm);
     intercomm.Free();
     comm1.Set_errhandler(MPI::ERRORS_THROW_EXCEPTIONS);
     return comm1;
@@ -242,7 +247,5 @@ void ICommImpl::importDataVoid(const std::string &group, bool source, int64_t th
     }
     IGNIS_OMP_EXCEPTION_END()
 
-    for (int64_t i = 1; i < threads_comm.size(); i++) { threads_comm[i].Free(); }
-
     executor_data->setPartitions(parts);
 }
\ No newline at end of file
@@ -181,8 +181,6 @@ void ICommImplClass::importData(const std::string &group, bool source, int64_t t
     }
     IGNIS_OMP_EXCEPTION_END()
 
-    for (int64_t i = 1; i < threads_comm.size(); i++) { threads_comm[i].Free(); }
-
     if(source){
         executor_data->deletePartitions();
     }else{
@@ -1,7 +1,11 @@
 
 #include "IIOImpl.h"
 #include "ignis/executor/api/IJsonValue.h"
+#include "ignis/executor/core/exception/ILogicError.h"
+#include "ignis/executor/core/io/IRowFile.h"
+#include "ignis/executor/core/io/ITextReader.h"
 #include "ignis/executor/core/storage/IVoidPartition.h"
+#include "ignis/executor/core/transport/IPipe.h"
 #include <algorithm>
 #include <fstream>
 #include <ghc/filesystem.hpp>
@@ -13,6 +17,31 @@ using namespace ignis::executor::core::modules::impl;
 using namespace ignis::executor::core::storage;
 using ignis::executor::api::IJsonValue;
 
+namespace {
+    struct ITextRecord {
+        void operator()(const char *record, size_t len, ignis::executor::api::IWriteIterator<std::string> &out) {
+            out.write(std::string(record, len));
+        }
+
+        void operator()(const char *record, size_t len, ignis::executor::api::IVector<std::string> &out) {
+            out.emplace_back(record, len);
+        }
+    };
+
+    /*Appends the bytes of fd from init to end to the partition*/
+    void readRange(int fd, int64_t init, int64_t end, std::vector<uint8_t> &buffer, IVoidPartition &partition) {
+        while (init < end) {
+            auto bytes = ::pread64(fd, &buffer[0], std::min<int64_t>(buffer.size(), end - init), init);
+            if (bytes <= 0) { throw ignis::executor::core::exception::ILogicError("error: object file read error"); }
+            std::shared_ptr<ignis::executor::core::transport::ITransport> chunk =
+                    std::make_shared<ignis::executor::core::transport::IMemoryBuffer>(
+                            &buffer[0], bytes, ignis::executor::core::transport::IMemoryBuffer::OBSERVE);
+            partition.read(chunk);
+            init += bytes;
+        }
+    }
+}// namespace
+
 IIOImpl::IIOImpl(std::shared_ptr<IExecutorData> &executorData) : IBaseImpl(executorData) {}
 
 IIOImpl::~IIOImpl() {}
@@ -58,162 +87,35 @@ std::ofstream IIOImpl::openFileWrite(const std::string &path) {
     return file;
 }
 
-void getline(std::ifstream &file, std::string &str, std::string &buffer, const std::string &delim,
-             const std::vector<std::string> &exs = {}) {
-    if (delim.length() == 1) {
-        std::getline(file, str, delim[0]);
-        return;
-    }
-    int dsize = delim.size();
-    int64_t overlap = 0;
-    str.clear();
-    while (std::getline(file, buffer, delim.back())) {
-        str.append(buffer);
-        str += delim.back();
-        if (str.size() >= dsize && str.rfind(delim) == (str.size() - dsize)) {
-            if (!exs.empty()) {
-                if (str.size() - overlap < dsize) { continue; }
-                bool f = false;
-                for (auto &ex : exs) {
-                    if (str.size() >= ex.size() && str.find(ex) == (str.size() - ex.size())) {
-                        overlap = str.size();
-                        f = true;
-                        break;
-                    }
-                }
-                if (f) { continue; }
-            }
-            str.resize(str.size() - dsize);
-            return;
-        }
-    }
-}
-
 void IIOImpl::plainFile(const std::string &path, int64_t minPartitions, const std::string &delim) {
     IGNIS_TRY()
     IGNIS_LOG(info) << (delim == "\n" ? "IO: reading text file" : "IO: reading plain file");
-    auto size = ghc::filesystem::file_size(path);
-    IGNIS_LOG(info) << "IO: file has " << size << " Bytes";
-    auto result = executor_data->getPartitionTools().newPartitionGroup<std::string>();
-    auto io_cores = ioCores();
-    decltype(result) thread_groups[io_cores];
-    size_t total_bytes = 0;
-    size_t elements = 0;
-
-    IGNIS_OMP_EXCEPTION_INIT()
-#pragma omp parallel reduction(+ : total_bytes, elements) firstprivate(minPartitions) num_threads(io_cores)
-    {
-        IGNIS_OMP_TRY()
-        std::ifstream file = openFileRead(path);
-        auto id = executor_data->getContext().threadId();
-        auto globalThreadId = executor_data->getContext().executorId() * io_cores + id;
-        auto threads = executor_data->getContext().executors() * io_cores;
-        size_t ex_chunk = size / threads;
-        size_t ex_chunk_init = globalThreadId * ex_chunk;
-        size_t ex_chunk_end = ex_chunk_init + ex_chunk;
-        size_t minPartitionSize = executor_data->getProperties().partitionMinimal();
-        minPartitions = (int64_t) std::ceil(minPartitions / (float) threads);
-        std::string str, buffer;
-        std::vector<std::string> exs;
-        std::string ldelim = delim;
-        int esize = 0;
-        if (ldelim.find('!') != std::string::npos) {
-            std::string flag = "\1";
-            while (ldelim.find(flag) != std::string::npos) { flag += "\1"; }
-            auto replaceAll = [](std::string &subject, const std::string &search, const std::string &replace) {
-                size_t pos = 0;
-                while ((pos = subject.find(search, pos)) != std::string::npos) {
-                    subject.replace(pos, search.length(), replace);
-                    pos += replace.length();
-                }
-            };
-            replaceAll(ldelim, "\\!", flag);
-            std::stringstream fields(ldelim);
-            std::string field;
-            for (int i = 0; std::getline(fields, field, '!'); i++) {
-                replaceAll(field, flag, "!");
-                if (i == 0) {
-                    ldelim = field;
-                } else {
-                    exs.push_back(field + ldelim);
-                }
+    std::vector<std::string> exs;
+    std::string ldelim = delim;
+    if (ldelim.find('!') != std::string::npos) {
+        std::string flag = "\1";
+        while (ldelim.find(flag) != std::string::npos) { flag += "\1"; }
+        auto replaceAll = [](std::string &subject, const std::string &search, const std::string &replace) {
+            size_t pos = 0;
+            while ((pos = subject.find(search, pos)) != std::string::npos) {
+                subject.replace(pos, search.length(), replace);
+                pos += replace.length();
             }
-        }
-        for (auto &ex : exs) {
-            if (ex.size() > esize) { esize = ex.size(); }
-        }
-        if (ldelim.empty()) { ldelim = "\n"; }
-        int dsize = ldelim.size();
-
-        if (globalThreadId > 0) {
-            size_t padding = ex_chunk_init >= (dsize + esize) ? ex_chunk_init - (dsize + esize) : 0;
-            file.seekg(padding);
-            int value;
-            if (dsize == 1 && esize == 0) {
-                do { padding++; } while ((value = file.get()) != ldelim[0] && value != EOF);
+        };
+        replaceAll(ldelim, "\\!", flag);
+        std::stringstream fields(ldelim);
+        std::string field;
+        for (int i = 0; std::getline(fields, field, '!'); i++) {
+            replaceAll(field, flag, "!");
+            if (i == 0) {
+                ldelim = field;
             } else {
-                do {
-                    getline(file, str, buffer, ldelim, exs);
-                    padding += str.size() + dsize;
-                } while (ex_chunk_init > padding);
-            }
-            ex_chunk_init = padding;
-            if (globalThreadId == threads - 1) { ex_chunk_end = size; }
-        }
-
-        if (ex_chunk / minPartitionSize < minPartitions) { minPartitionSize = ex_chunk / minPartitions; }
-
-        thread_groups[id] = executor_data->getPartitionTools().newPartitionGroup<std::string>();
-        auto partition = executor_data->getPartitionTools().newPartition<std::string>();
-        auto write_iterator = partition->writeIterator();
-        thread_groups[id]->add(partition);
-        size_t partitionInit = ex_chunk_init;
-        size_t filepos = ex_chunk_init;
-
-        if (executor_data->getPartitionTools().isMemory(*partition)) {
-            auto part_men = executor_data->getPartitionTools().toMemory(partition);
-            while (filepos < ex_chunk_end) {
-                if ((filepos - partitionInit) > minPartitionSize) {
-                    part_men->fit();
-                    part_men = executor_data->getPartitionTools().newMemoryPartition<std::string>();
-                    thread_groups[id]->add(part_men);
-                    partitionInit = filepos;
-                }
-                getline(file, str, buffer, ldelim, exs);
-                filepos += str.size() + dsize;
-                elements++;
-                part_men->inner().push_back(str);
-            }
-        } else {
-            while (filepos < ex_chunk_end) {
-                if ((filepos - partitionInit) > minPartitionSize) {
-                    partition->fit();
-                    partition = executor_data->getPartitionTools().newPartition<std::string>();
-                    write_iterator = partition->writeIterator();
-                    thread_groups[id]->add(partition);
-                    partitionInit = filepos;
-                }
-                getline(file, str, buffer, ldelim, exs);
-                filepos += str.size() + dsize;
-                elements++;
-                write_iterator->write(str);
+                exs.push_back(field + ldelim);
             }
         }
-
-        total_bytes += (size_t) file.tellg() - ex_chunk_init;
-
-        IGNIS_OMP_CATCH()
     }
-    IGNIS_OMP_EXCEPTION_END()
-
-    for (auto group : thread_groups) {
-        for (auto part : *group) { result->add(part); }
-    }
-
-    IGNIS_LOG(info) << "IO: created  " << result->partitions() << " partitions, " << elements << " lines and "
-                    << total_bytes << " Bytes read ";
-
-    executor_data->setPartitions(result);
+    if (ldelim.empty()) { ldelim = "\n"; }
+    readRecords<std::string, ITextRecord>(path, minPartitions, ldelim, exs);
     IGNIS_CATCH()
 }
 
@@ -231,11 +133,13 @@ void IIOImpl::partitionTextFile(const std::string &path, int64_t first, int64_t
 #pragma omp for schedule(dynamic)
         for (int64_t p = 0; p < partitions; p++) {
             auto file_name = partitionFileName(path, first + p);
-            std::ifstream file = openFileRead(file_name);
+            openFileRead(file_name);//Only to check
+            io::ITextReader reader(file_name, "\n", {}, transport::IPipe::bufferSize());
             auto partition = (*group)[p];
             auto write_iterator = partition->writeIterator();
-            std::string buffer;
-            while (std::getline(file, buffer, '\n')) { write_iterator->write(buffer); }
+            const char *line;
+            size_t len;
+            while (reader.next(line, len)) { write_iterator->write(std::string(line, len)); }
             partition->fit();
         }
         IGNIS_OMP_CATCH()
@@ -245,26 +149,102 @@ void IIOImpl::partitionTextFile(const std::string &path, int64_t first, int64_t
     IGNIS_CATCH()
 }
 
+std::vector<std::pair<int64_t, int64_t>> IIOImpl::objectBlocks(const std::string &path, int64_t first,
+                                                               int64_t partitions) {
+    std::vector<std::pair<int64_t, int64_t>> blocks;
+    for (int64_t p = first; p < first + partitions; p++) {
+        auto file_name = partitionFileName(path, p);
+        openFileRead(file_name);//Only to check
+        if (io::IColumnFile::isColumnar(file_name)) {
+            io::IColumnFileReader reader(file_name);
+            for (int64_t g = 0; g < reader.groups(); g++) { blocks.emplace_back(p, g); }
+        } else {
+            int64_t n = std::max<int64_t>(io::IRowFile::readIndex(file_name).size(), 1);
+            for (int64_t b = 0; b < n; b++) { blocks.emplace_back(p, b); }
+        }
+    }
+    return blocks;
+}
+
 void IIOImpl::partitionObjectFileVoid(const std::string &path, int64_t first, int64_t partitions) {
     IGNIS_TRY()
     IGNIS_LOG(info) << "IO: reading partitions object file";
     auto group = executor_data->getPartitionTools().newPartitionGroup<IVoidPartition::VOID_TYPE>();
-
     for (int64_t p = 0; p < partitions; p++) {
         auto file_name = partitionFileName(path, first + p);
         openFileRead(file_name);//Only to check
-        auto header = std::make_shared<transport::IFileTransport>(file_name + ".header");
-        auto transport = std::make_shared<transport::IFileTransport>(file_name);
+        if (io::IColumnFile::isColumnar(file_name)) {
+            throw exception::IInvalidArgument(file_name + " is a columnar file, its element type is required");
+        }
+    }
+    auto blocks = objectBlocks(path, first, partitions);
+    int64_t nblocks = blocks.size();
+    int64_t threads = ioCores();
+    std::vector<int64_t> file_blocks(partitions + 1, 0);
+    for (auto &block : blocks) { file_blocks[block.first - first + 1]++; }
+    for (int64_t p = 0; p < partitions; p++) { file_blocks[p + 1] += file_blocks[p]; }
+    /*Like partitionObjectFile, the bytes of the blocks of a thread are copied with the file it keeps open*/
+    std::vector<std::shared_ptr<IVoidPartition>> files(partitions);
+    std::vector<std::shared_ptr<IVoidPartition>> parts(nblocks);
 
-        auto partition =
-                executor_data->getPartitionTools().newVoidPartition(100 + ghc::filesystem::file_size(file_name));
-        partition->read(reinterpret_cast<std::shared_ptr<transport::ITransport> &>(header));
-        partition->read(reinterpret_cast<std::shared_ptr<transport::ITransport> &>(transport));
+    IGNIS_OMP_EXCEPTION_INIT()
+#pragma omp parallel num_threads(threads)
+    {
+        IGNIS_OMP_TRY()
+        int64_t reader_file = -1;
+        int64_t file_size = 0;
+        std::shared_ptr<transport::IFileTransport> file;
+        std::vector<io::IRowFile::Block> index;
+        std::vector<uint8_t> buffer(transport::IPipe::bufferSize());
+#pragma omp for schedule(static, 1)
+        for (int64_t t = 0; t < threads; t++) {
+            int64_t end = nblocks * (t + 1) / threads;
+            for (int64_t b = nblocks * t / threads; b < end;) {
+                int64_t p = blocks[b].first - first;
+                int64_t b_end = std::min(end, file_blocks[p + 1]);
+                auto file_name = partitionFileName(path, first + p);
+                if (reader_file != p) {
+                    file = std::make_shared<transport::IFileTransport>(file_name);
+                    index = io::IRowFile::readIndex(file_name);
+                    file_size = ghc::filesystem::file_size(file_name);
+                    reader_file = p;
+                }
+                int64_t offset = index.empty() ? 0 : index[blocks[b].second].offset;
+                int64_t offset_end = b_end < file_blocks[p + 1] ? index[blocks[b_end].second].offset : file_size;
 
-        partition->fit();
-        group->add(partition);
+                auto partition = executor_data->getPartitionTools().newVoidPartition(100 + offset_end - offset);
+                if (b == file_blocks[p]) {
+                    auto header = std::make_shared<transport::IFileTransport>(file_name + ".header");
+                    partition->read(reinterpret_cast<std::shared_ptr<transport::ITransport> &>(header));
+                }
+                readRange(file->getFD(), offset, offset_end, buffer, *partition);
+                if (b == file_blocks[p] && b_end == file_blocks[p + 1]) {
+                    partition->fit();
+                    files[p] = partition;
+                } else {
+                    parts[b] = partition;
+                }
+                b = b_end;
+            }
+        }
+        IGNIS_OMP_CATCH()
     }
+    IGNIS_OMP_EXCEPTION_END()
 
+    for (int64_t p = 0; p < partitions; p++) {
+        if (!files[p]) {
+            files[p] = parts[file_blocks[p]];
+            for (int64_t b = file_blocks[p] + 1; b < file_blocks[p + 1]; b++) {
+                if (parts[b]) {
+                    auto trans = parts[b]->readTransport();
+                    files[p]->read(trans);
+                    parts[b].reset();
+                }
+            }
+            files[p]->fit();
+        }
+        group->add(files[p]);
+    }
     executor_data->setPartitions(group);
     IGNIS_CATCH()
 }
@@ -3,7 +3,10 @@
 #define IGNIS_IIOIMPL_H
 
 #include "IBaseImpl.h"
+#include "ignis/executor/core/io/IColumnReader.h"
+#include "ignis/executor/core/io/IRowReader.h"
 #include <fstream>
+#include <vector>
 
 namespace ignis {
     namespace executor {
@@ -21,15 +24,37 @@ namespace ignis {
 
                         void textFile(const std::string &path, int64_t minPartitions);
 
+                        /*Newline delimited json, the file is split between threads and executors like a text file*/
+                        template<typename Tp>
+                        void jsonLinesFile(const std::string &path, int64_t minPartitions);
+
                         void partitionObjectFileVoid(const std::string &path, int64_t first, int64_t partitions);
 
                         void partitionJsonFileVoid(const std::string &path, int64_t first, int64_t partitions);
 
+                        /*Every thread reads a contiguous range of the blocks of the files with a single reader, files
+                         * with several blocks are split between threads*/
                         template<typename Tp>
                         void partitionObjectFile(const std::string &path, int64_t first, int64_t partitions);
 
+                        /*Reads the object files 0 to files-1 as a single dataset, every executor and thread takes a
+                         * range of blocks. Row groups are the blocks of columnar files, row files use their index*/
+                        template<typename Tp>
+                        void objectFile(const std::string &path, int64_t files, int64_t minPartitions);
+
                         void partitionTextFile(const std::string &path, int64_t first, int64_t partitions);
 
+                        /*Reads only the columns of Col starting at column from a columnar object file of Tp*/
+                        template<typename Tp, typename Col>
+                        void partitionColumnFile(const std::string &path, int64_t first, int64_t partitions,
+                                                 int64_t column);
+
+                        /*Row groups whose statistics of key_column prove that no key is in [min, max] are skipped,
+                         * rows of the other groups are not filtered*/
+                        template<typename Tp, typename Col, typename Key>
+                        void partitionColumnFile(const std::string &path, int64_t first, int64_t partitions,
+                                                 int64_t column, int64_t key_column, const Key &min, const Key &max);
+
                         template<typename Tp>
                         void partitionJsonFile(const std::string &path, int64_t first, int64_t partitions);
 
@@ -51,6 +76,28 @@ namespace ignis {
                         virtual ~IIOImpl();
                     private:
                         int ioCores();
+
+                        /*Reader of the file of the last block read by a thread, the next blocks of the file reuse it*/
+                        template<typename Tp>
+                        struct IObjectReader {
+                            int64_t file = -1;
+                            std::shared_ptr<io::IColumnReader<Tp>> column;
+                            std::shared_ptr<io::IRowReader<Tp>> row;
+                        };
+
+                        /*(file, block) of every block of the object files, row groups in columnar files*/
+                        std::vector<std::pair<int64_t, int64_t>> objectBlocks(const std::string &path, int64_t first,
+                                                                              int64_t partitions);
+
+                        template<typename Tp>
+                        void readObjectBlocks(const std::string &path,
+                                              const std::vector<std::pair<int64_t, int64_t>> &blocks, int64_t init,
+                                              int64_t end, storage::IPartition<Tp> &part, IObjectReader<Tp> &reader);
+
+                        /*Splits the records of path between threads and executors, Parser writes every record*/
+                        template<typename Tp, typename Parser>
+                        void readRecords(const std::string &path, int64_t minPartitions, const std::string &delim,
+                                         const std::vector<std::string> &exs);
                     };
                 }// namespace impl
             }    // namespace modules
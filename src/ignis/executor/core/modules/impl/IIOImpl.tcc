@@ -1,12 +1,21 @@
 
 #include "IIOImpl.h"
+#include "ignis/executor/core/io/IColumnReader.h"
+#include "ignis/executor/core/io/IColumnWriter.h"
 #include "ignis/executor/core/io/IJsonReader.h"
+#include "ignis/executor/core/io/IJsonStreamReader.h"
 #include "ignis/executor/core/io/IJsonWriter.h"
 #include "ignis/executor/core/io/IPrinter.h"
+#include "ignis/executor/core/io/ITextReader.h"
 #include "ignis/executor/core/protocol/IObjectProtocol.h"
+#include "ignis/executor/core/transport/IPipe.h"
+#include "ignis/executor/core/transport/IWriteBehind.h"
 #include "ignis/executor/core/transport/IZlibTransport.h"
+#include <algorithm>
 #include <climits>
+#include <cmath>
 #include <fstream>
+#include <ghc/filesystem.hpp>
 
 #define IIOImplClass ignis::executor::core::modules::impl::IIOImpl
 
@@ -34,27 +43,248 @@ int64_t IIOImplClass::partitionApproxSize() {
     IGNIS_CATCH()
 }
 
+template<typename Tp>
+void IIOImplClass::jsonLinesFile(const std::string &path, int64_t minPartitions) {
+    IGNIS_TRY()
+    IGNIS_LOG(info) << "IO: reading json lines file";
+    readRecords<Tp, io::IJsonStreamReader<Tp>>(path, minPartitions, "\n", {});
+    IGNIS_CATCH()
+}
+
+template<typename Tp, typename Parser>
+void IIOImplClass::readRecords(const std::string &path, int64_t minPartitions, const std::string &delim,
+                               const std::vector<std::string> &exs) {
+    auto size = ghc::filesystem::file_size(path);
+    IGNIS_LOG(info) << "IO: file has " << size << " Bytes";
+    auto result = executor_data->getPartitionTools().newPartitionGroup<Tp>();
+    auto io_cores = ioCores();
+    decltype(result) thread_groups[io_cores];
+    size_t total_bytes = 0;
+    size_t elements = 0;
+    size_t dsize = delim.size();
+    size_t esize = 0;
+    for (auto &ex : exs) { esize = std::max(esize, ex.size()); }
+    openFileRead(path);//Only to check
+
+    IGNIS_OMP_EXCEPTION_INIT()
+#pragma omp parallel reduction(+ : total_bytes, elements) firstprivate(minPartitions) num_threads(io_cores)
+    {
+        IGNIS_OMP_TRY()
+        auto id = executor_data->getContext().threadId();
+        auto globalThreadId = executor_data->getContext().executorId() * io_cores + id;
+        auto threads = executor_data->getContext().executors() * io_cores;
+        size_t ex_chunk = size / threads;
+        size_t ex_chunk_init = globalThreadId * ex_chunk;
+        size_t ex_chunk_end = ex_chunk_init + ex_chunk;
+        size_t minPartitionSize = executor_data->getProperties().partitionMinimal();
+        minPartitions = (int64_t) std::ceil(minPartitions / (float) threads);
+        io::ITextReader reader(path, delim, exs, transport::IPipe::bufferSize());
+        Parser parser;
+        const char *record;
+        size_t len;
+
+        if (globalThreadId > 0) {
+            reader.seek(ex_chunk_init >= (dsize + esize) ? ex_chunk_init - (dsize + esize) : 0);
+            while (reader.next(record, len) && ex_chunk_init > reader.tell()) {}
+            ex_chunk_init = reader.tell();
+            if (globalThreadId == threads - 1) { ex_chunk_end = size; }
+        }
+
+        if (ex_chunk / minPartitionSize < minPartitions) { minPartitionSize = ex_chunk / minPartitions; }
+
+        auto &tools = executor_data->getPartitionTools();
+        thread_groups[id] = tools.newPartitionGroup<Tp>();
+        auto partition = tools.newPartition<Tp>();
+        auto write_iterator = partition->writeIterator();
+        /*Memory partitions are filled without the write iterator*/
+        bool memory = tools.isMemory(*partition);
+        api::IVector<Tp> *men = memory ? &tools.toMemory(*partition).inner() : nullptr;
+        thread_groups[id]->add(partition);
+        size_t partitionInit = ex_chunk_init;
+        size_t filepos = ex_chunk_init;
+
+        while (filepos < ex_chunk_end) {
+            if ((filepos - partitionInit) > minPartitionSize) {
+                partition->fit();
+                partition = tools.newPartition<Tp>();
+                write_iterator = partition->writeIterator();
+                if (memory) { men = &tools.toMemory(*partition).inner(); }
+                thread_groups[id]->add(partition);
+                partitionInit = filepos;
+            }
+            if (!reader.next(record, len)) { break; }
+            filepos = reader.tell();
+            if (memory) {
+                parser(record, len, *men);
+            } else {
+                parser(record, len, *write_iterator);
+            }
+        }
+
+        /*Parsers can skip records, only the written elements are counted*/
+        for (auto &part : *thread_groups[id]) { elements += part->size(); }
+        total_bytes += reader.tell() - ex_chunk_init;
+
+        IGNIS_OMP_CATCH()
+    }
+    IGNIS_OMP_EXCEPTION_END()
+
+    for (auto group : thread_groups) {
+        for (auto part : *group) { result->add(part); }
+    }
+
+    IGNIS_LOG(info) << "IO: created  " << result->partitions() << " partitions, " << elements << " records and "
+                    << total_bytes << " Bytes read ";
+
+    executor_data->setPartitions(result);
+}
+
 template<typename Tp>
 void IIOImplClass::partitionObjectFile(const std::string &path, int64_t first, int64_t partitions) {
     IGNIS_TRY()
     IGNIS_LOG(info) << "IO: reading partitions object file";
     auto group = executor_data->getPartitionTools().newPartitionGroup<Tp>(partitions);
+    auto blocks = objectBlocks(path, first, partitions);
+    int64_t nblocks = blocks.size();
+    int64_t threads = ioCores();
+    std::vector<int64_t> file_blocks(partitions + 1, 0);
+    for (auto &block : blocks) { file_blocks[block.first - first + 1]++; }
+    for (int64_t p = 0; p < partitions; p++) { file_blocks[p + 1] += file_blocks[p]; }
+    /*Every thread reads a contiguous range of blocks with a single reader, a file split between threads is read into
+     * parts that are joined in order*/
+    std::vector<std::shared_ptr<storage::IPartition<Tp>>> parts(nblocks);
+
+    IGNIS_OMP_EXCEPTION_INIT()
+#pragma omp parallel num_threads(threads)
+    {
+        IGNIS_OMP_TRY()
+        IObjectReader<Tp> reader;
+#pragma omp for schedule(static, 1)
+        for (int64_t t = 0; t < threads; t++) {
+            int64_t end = nblocks * (t + 1) / threads;
+            for (int64_t b = nblocks * t / threads; b < end;) {
+                int64_t p = blocks[b].first - first;
+                int64_t b_end = std::min(end, file_blocks[p + 1]);
+                if (b == file_blocks[p] && b_end == file_blocks[p + 1]) {
+                    readObjectBlocks(path, blocks, b, b_end, *(*group)[p], reader);
+                    (*group)[p]->fit();
+                } else {
+                    parts[b] = executor_data->getPartitionTools().newPartition<Tp>();
+                    readObjectBlocks(path, blocks, b, b_end, *parts[b], reader);
+                }
+                b = b_end;
+            }
+        }
+        IGNIS_OMP_CATCH()
+    }
+    IGNIS_OMP_EXCEPTION_END()
+
+    for (int64_t p = 0; p < partitions; p++) {
+        if (file_blocks[p] == file_blocks[p + 1] || !parts[file_blocks[p]]) { continue; }
+        for (int64_t b = file_blocks[p]; b < file_blocks[p + 1]; b++) {
+            if (parts[b]) {
+                (*group)[p]->moveFrom(*parts[b]);
+                parts[b].reset();
+            }
+        }
+        (*group)[p]->fit();
+    }
+    executor_data->setPartitions(group);
+    IGNIS_CATCH()
+}
+
+template<typename Tp>
+void IIOImplClass::objectFile(const std::string &path, int64_t files, int64_t minPartitions) {
+    IGNIS_TRY()
+    IGNIS_LOG(info) << "IO: reading object file";
+    auto blocks = objectBlocks(path, 0, files);
+    auto executors = executor_data->getContext().executors();
+    auto id = executor_data->getContext().executorId();
+    int64_t init = blocks.size() * id / executors;
+    int64_t end = blocks.size() * (id + 1) / executors;
+    int64_t partitions = std::min<int64_t>(std::ceil(minPartitions / (float) executors), end - init);
+    if (partitions <= 0 && end > init) { partitions = 1; }
+    IGNIS_LOG(info) << "IO: executor reads " << (end - init) << " of " << blocks.size() << " blocks";
+    auto group = executor_data->getPartitionTools().newPartitionGroup<Tp>(partitions);
 
     IGNIS_OMP_EXCEPTION_INIT()
 #pragma omp parallel num_threads(ioCores())
+    {
+        IGNIS_OMP_TRY()
+        IObjectReader<Tp> reader;
+        /*Contiguous partitions, the blocks of a thread follow each other and share its reader*/
+#pragma omp for schedule(static)
+        for (int64_t p = 0; p < partitions; p++) {
+            int64_t p_init = init + (end - init) * p / partitions;
+            int64_t p_end = init + (end - init) * (p + 1) / partitions;
+            readObjectBlocks(path, blocks, p_init, p_end, *(*group)[p], reader);
+            (*group)[p]->fit();
+        }
+        IGNIS_OMP_CATCH()
+    }
+    IGNIS_OMP_EXCEPTION_END()
+    executor_data->setPartitions(group);
+    IGNIS_CATCH()
+}
+
+template<typename Tp>
+void IIOImplClass::readObjectBlocks(const std::string &path, const std::vector<std::pair<int64_t, int64_t>> &blocks,
+                                    int64_t init, int64_t end, storage::IPartition<Tp> &part,
+                                    IObjectReader<Tp> &reader) {
+    auto write_iterator = part.writeIterator();
+    for (int64_t b = init; b < end; b++) {
+        if (reader.file != blocks[b].first) {
+            std::string file_name = partitionFileName(path, blocks[b].first);
+            reader.column.reset();
+            reader.row.reset();
+            if (io::IColumnFile::isColumnar(file_name)) {
+                reader.column = std::make_shared<io::IColumnReader<Tp>>(file_name);
+            } else {
+                reader.row = std::make_shared<io::IRowReader<Tp>>(file_name);
+            }
+            reader.file = blocks[b].first;
+        }
+        if (reader.column) {
+            reader.column->readGroup(blocks[b].second, *write_iterator);
+        } else {
+            reader.row->readBlock(blocks[b].second, *write_iterator);
+        }
+    }
+}
+
+template<typename Tp, typename Col>
+void IIOImplClass::partitionColumnFile(const std::string &path, int64_t first, int64_t partitions, int64_t column) {
+    partitionColumnFile<Tp, Col, Col>(path, first, partitions, column, -1, Col(), Col());
+}
+
+template<typename Tp, typename Col, typename Key>
+void IIOImplClass::partitionColumnFile(const std::string &path, int64_t first, int64_t partitions, int64_t column,
+                                       int64_t key_column, const Key &min, const Key &max) {
+    IGNIS_TRY()
+    IGNIS_LOG(info) << "IO: reading partitions columnar file";
+    auto group = executor_data->getPartitionTools().newPartitionGroup<Col>(partitions);
+    int64_t groups = 0;
+    int64_t skipped = 0;
+
+    IGNIS_OMP_EXCEPTION_INIT()
+#pragma omp parallel reduction(+ : groups, skipped) num_threads(ioCores())
     {
         IGNIS_OMP_TRY()
 #pragma omp for schedule(dynamic)
         for (int64_t p = 0; p < partitions; p++) {
             std::string file_name = partitionFileName(path, first + p);
             openFileRead(file_name);//Only to check
-            storage::IDiskPartition<Tp> open(file_name, 0, true, true);
-            (*group)[p]->copyFrom(open);
+            io::IColumnReader<Tp> reader(file_name);
+            if (key_column >= 0) { skipped += reader.template filter<Key>(key_column, min, max); }
+            groups += reader.groups();
+            auto write_iterator = (*group)[p]->writeIterator();
+            reader.template read<Col>(column, *write_iterator);
             (*group)[p]->fit();
         }
         IGNIS_OMP_CATCH()
     }
     IGNIS_OMP_EXCEPTION_END()
+    IGNIS_LOG(info) << "IO: " << skipped << " of " << groups << " row groups skipped by statistics";
     executor_data->setPartitions(group);
     IGNIS_CATCH()
 }
@@ -72,10 +302,10 @@ void IIOImplClass::partitionJsonFile(const std::string &path, int64_t first, int
 #pragma omp for schedule(dynamic)
         for (int64_t p = 0; p < partitions; p++) {
             auto file_name = partitionFileName(path, first + p)  + ".json";
-            std::ifstream file = openFileRead(file_name);
-            io::IJsonReader<api::IWriteIterator<Tp>> reader;
+            openFileRead(file_name);//Only to check
+            io::IJsonStreamReader<Tp> reader;
             auto write_iterator = (*group)[p]->writeIterator();
-            reader(file, *write_iterator);
+            reader(file_name, *write_iterator, true);
             (*group)[p]->fit();
         }
         IGNIS_OMP_CATCH()
@@ -90,8 +320,14 @@ void IIOImplClass::saveAsObjectFile(const std::string &path, int8_t compression,
     IGNIS_TRY()
     IGNIS_LOG(info) << "IO: saving as object file";
     auto group = executor_data->getAndDeletePartitions<Tp>();
+    auto cmp = executor_data->getProperties().ioCompression(compression);
+    auto columnar = executor_data->getProperties().ioColumnar();
+    auto block_bytes = executor_data->getProperties().ioBlock();
+    auto io_cores = ioCores();
+    auto writers = executor_data->getProperties().ioWriters();
+    transport::IWriteBehind writer(transport::IPipe::bufferSize(), io_cores + 2 * writers, writers);
     IGNIS_OMP_EXCEPTION_INIT()
-#pragma omp parallel num_threads(ioCores())
+#pragma omp parallel num_threads(io_cores)
     {
         IGNIS_OMP_TRY()
 #pragma omp for schedule(dynamic)
@@ -103,14 +339,47 @@ void IIOImplClass::saveAsObjectFile(const std::string &path, int8_t compression,
                 openFileWrite(file_name);//Only to check
             };
 
-            storage::IDiskPartition<Tp> save(file_name, compression, true);
-            (*group)[p]->copyTo(save);
-            save.sync();
+            if (columnar > 0 && io::IColumnType<Tp>::columnar) {
+                auto file = writer.open(file_name);
+                io::IColumnWriter<Tp> save(file, cmp, columnar);
+                auto reader = (*group)[p]->readIterator();
+                while (reader->hasNext()) { save.write(reader->next()); }
+                save.close();
+                file->close();
+            } else {
+                storage::IDiskPartition<Tp> save(file_name, cmp, true);
+                auto &part = *(*group)[p];
+                int64_t size = part.size();
+                int64_t blocks = 1;
+                if (block_bytes > 0) { blocks = std::min<int64_t>(part.bytes() / block_bytes, size); }
+                blocks = std::max<int64_t>(blocks, 1);
+                std::vector<io::IRowFile::Block> index(blocks);
+                if (blocks == 1) {
+                    part.copyTo(save);
+                    index[0].offset = 0;
+                    index[0].rows = size;
+                } else {
+                    auto reader = part.readIterator();
+                    auto write_iterator = save.writeIterator();
+                    int64_t offset = 0;
+                    for (int64_t b = 0; b < blocks; b++) {
+                        index[b].offset = offset;
+                        index[b].rows = size * (b + 1) / blocks - size * b / blocks;
+                        for (int64_t i = 0; i < index[b].rows; i++) { write_iterator->write(reader->next()); }
+                        /*The codec is flushed, the next block does not depend on the previous ones*/
+                        save.sync();
+                        offset = ghc::filesystem::file_size(file_name);
+                    }
+                }
+                save.sync();
+                io::IRowFile::writeIndex(file_name, index);
+            }
             (*group)[p].reset();
         }
         IGNIS_OMP_CATCH()
     }
     IGNIS_OMP_EXCEPTION_END()
+    writer.wait();
     IGNIS_CATCH()
 }
 
@@ -120,34 +389,41 @@ void IIOImplClass::saveAsTextFile(const std::string &path, int64_t first) {
     IGNIS_LOG(info) << "IO: saving as text file";
     auto group = executor_data->getAndDeletePartitions<Tp>();
     bool isMemory = executor_data->getPartitionTools().isMemory(*group);
+    auto io_cores = ioCores();
+    auto writers = executor_data->getProperties().ioWriters();
+    transport::IWriteBehind writer(transport::IPipe::bufferSize(), io_cores + 2 * writers, writers);
 
     IGNIS_OMP_EXCEPTION_INIT()
-#pragma omp parallel num_threads(ioCores())
+#pragma omp parallel num_threads(io_cores)
     {
         IGNIS_OMP_TRY()
 #pragma omp for schedule(dynamic)
         for (int64_t p = 0; p < group->partitions(); p++) {
-            std::ofstream file;
+            std::shared_ptr<transport::IWriteBehindFile> file;
 #pragma omp critical
             {
                 auto file_name = partitionFileName(path, first + p);
-                file = openFileWrite(file_name);
+                openFileWrite(file_name);//Only to check
+                file = writer.open(file_name);
             };
+            std::ostream out(file.get());
 
             auto &part = *(*group)[p];
             if (isMemory) {
                 auto &men_part = executor_data->getPartitionTools().toMemory(part);
                 io::IPrinter<typename std::remove_reference<decltype(men_part.inner())>::type> printer;
-                printer(file, men_part.inner());
+                printer(out, men_part.inner());
             } else {
                 io::IPrinter<api::IReadIterator<Tp>> printer;
-                printer(file, *part.readIterator());
+                printer(out, *part.readIterator());
             }
+            file->close();
             (*group)[p].reset();
         }
         IGNIS_OMP_CATCH()
     }
     IGNIS_OMP_EXCEPTION_END()
+    writer.wait();
     IGNIS_CATCH()
 }
 
@@ -156,27 +432,34 @@ void IIOImplClass::saveAsJsonFile(const std::string &path, int64_t first, bool p
     IGNIS_TRY()
     IGNIS_LOG(info) << "IO: saving as json file";
     auto group = executor_data->getAndDeletePartitions<Tp>();
+    auto io_cores = ioCores();
+    auto writers = executor_data->getProperties().ioWriters();
+    transport::IWriteBehind writer(transport::IPipe::bufferSize(), io_cores + 2 * writers, writers);
 
     IGNIS_OMP_EXCEPTION_INIT()
-#pragma omp parallel num_threads(ioCores())
+#pragma omp parallel num_threads(io_cores)
     {
         IGNIS_OMP_TRY()
 #pragma omp for schedule(dynamic)
         for (int64_t p = 0; p < group->partitions(); p++) {
-            std::ofstream file;
+            std::shared_ptr<transport::IWriteBehindFile> file;
 #pragma omp critical
             {
                 auto file_name = partitionFileName(path, first + p) + ".json";
-                file = openFileWrite(file_name);
+                openFileWrite(file_name);//Only to check
+                file = writer.open(file_name);
             };
+            std::ostream out(file.get());
             auto &part = *(*group)[p];
-            io::IJsonWriter<api::IReadIterator<Tp>> writer;
-            writer(file, *part.readIterator(), pretty);
+            io::IJsonWriter<api::IReadIterator<Tp>> json_writer;
+            json_writer(out, *part.readIterator(), pretty);
+            file->close();
             (*group)[p].reset();
         }
         IGNIS_OMP_CATCH()
     }
     IGNIS_OMP_EXCEPTION_END()
+    writer.wait();
 
     IGNIS_CATCH()
 }
@@ -32,7 +32,7 @@ namespace ignis {
 
                     private:
                         template<typename Tp>
-                        void countByReduce(std::unordered_map<Tp, int64_t> &acum);
+                        void countByReduce(IHashMap<Tp, int64_t> &acum);
                     };
                 }// namespace impl
             }    // namespace modules
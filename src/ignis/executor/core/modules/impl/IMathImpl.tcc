@@ -168,7 +168,7 @@ void IMathImplClass::countByKey() {
     bool isMemory = executor_data->getPartitionTools().isMemory(*input);
     auto threads = executor_data->getCores();
 
-    std::unordered_map<typename Tp::first_type, int64_t> acum[threads];
+    IHashMap<typename Tp::first_type, int64_t> acum[threads];
     IGNIS_LOG(info) << "Math: counting local keys " << input->partitions() << " partitions";
     IGNIS_OMP_EXCEPTION_INIT()
 #pragma omp parallel
@@ -217,7 +217,7 @@ void IMathImplClass::countByValue() {
     bool isMemory = executor_data->getPartitionTools().isMemory(*input);
     auto threads = executor_data->getCores();
 
-    std::unordered_map<typename Tp::second_type, int64_t> acum[threads];
+    IHashMap<typename Tp::second_type, int64_t> acum[threads];
     IGNIS_LOG(info) << "Math: counting local values " << input->partitions() << " partitions";
     IGNIS_OMP_EXCEPTION_INIT()
 #pragma omp parallel
@@ -261,7 +261,7 @@ void IMathImplClass::countByValue() {
 }
 
 template<typename Tp>
-void IMathImplClass::countByReduce(std::unordered_map<Tp, int64_t> &acum) {
+void IMathImplClass::countByReduce(IHashMap<Tp, int64_t> &acum) {
     IGNIS_LOG(info) << "Math: reducing global counting";
     auto executors = executor_data->mpi().executors();
     auto group = executor_data->getPartitionTools().newPartitionGroup<std::pair<Tp, int64_t>>(executors);
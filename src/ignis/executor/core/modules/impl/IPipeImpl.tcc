@@ -73,8 +73,9 @@ void IPipeImplCLass::map() {
                 auto &men_part = executor_data->getPartitionTools().toMemory(*(*input)[p]);
                 for (size_t i = 0; i < sz; i++) { men_writer.write(function.call(men_part[i], context)); }
             } else {
-                auto reader = (*input)[p]->readIterator();
-                for (size_t i = 0; i < sz; i++) { writer->write(function.call(reader->next(), context)); }
+                readBatches(*(*input)[p], [&](typename Function::_T_type &elem) {
+                    writer->write(function.call(elem, context));
+                });
             }
             (*input)[p].reset();
             (*output)[p]->fit();
@@ -121,17 +122,9 @@ void IPipeImplCLass::filter() {
                     }
                 }
             } else {
-                auto reader = (*input)[p]->readIterator();
-                for (size_t i = 0; i < sz; i++) {
-                    auto &elem = reader->next();
-                    if (function.call(elem, context)) {
-                        if (cache) {
-                            writer->write(std::move(elem));
-                        } else {
-                            writer->write(elem);
-                        }
-                    }
-                }
+                readBatches(*(*input)[p], [&](typename Function::_T_type &elem) {
+                    if (function.call(elem, context)) { writer->write(std::move(elem)); }
+                });
             }
             (*input)[p].reset();
             (*output)[p]->fit();
@@ -490,8 +483,7 @@ void IPipeImplCLass::foreach () {
                 auto &men_part = executor_data->getPartitionTools().toMemory(*(*input)[p]);
                 for (size_t i = 0; i < sz; i++) { function.call(men_part[i], context); }
             } else {
-                auto reader = (*input)[p]->readIterator();
-                for (size_t i = 0; i < sz; i++) { function.call(reader->next(), context); }
+                readBatches(*(*input)[p], [&](typename Function::_T_type &elem) { function.call(elem, context); });
             }
             (*input)[p].reset();
         }
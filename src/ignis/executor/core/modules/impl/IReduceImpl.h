@@ -3,6 +3,8 @@
 #define IGNIS_IREDUCEIMPL_H
 
 #include "IBaseImpl.h"
+#include "ignis/executor/core/IHyperLogLog.h"
+#include <limits>
 
 namespace ignis {
     namespace executor {
@@ -37,9 +39,13 @@ namespace ignis {
                         template<typename Tp, typename Function>
                         void reduceByKey(int64_t numPartitions, bool localReduce);
 
+                        /*Without hashing, values are combined into numPartitions hashed partitions for mergeByKey*/
                         template<typename Tp, typename Function>
                         void aggregateByKey(int64_t numPartitions, bool hashing);
 
+                        template<typename Tp, typename Function>
+                        void mergeByKey();
+
                         template<typename Tp, typename Function>
                         void foldByKey(int64_t numPartitions, bool localFold);
 
@@ -82,12 +88,51 @@ namespace ignis {
                         template<typename Tp>
                         inline void keyHashing(int64_t numPartitions);
 
+                        /*0 for a shuffle join, otherwise the input that should be broadcast*/
+                        template<typename Tp>
+                        int broadcastSide(storage::IPartitionGroup<Tp> &first, storage::IPartitionGroup<Tp> &second);
+
+                        template<typename Tp>
+                        void broadcastJoin(const std::string &other, bool first);
+
+                        template<typename Tp>
+                        inline void heavyKeys(int64_t numPartitions,
+                                              IHashMap<typename Tp::first_type, int64_t> &heavy);
+
+                        template<typename Tp>
+                        inline void skewHashing(int64_t numPartitions,
+                                                IHashMap<typename Tp::first_type, int64_t> &heavy, bool replicate);
+
+                        template<typename Tp, typename Tp2, typename Create, typename Combine>
+                        inline void combineHashing(int64_t numPartitions, Create create, Combine combine);
+
                         template<typename Tp>
                         inline void keyExchanging();
 
                         template<typename Tp>
                         inline void distinctFilter(storage::IPartitionGroup<Tp>& parts);
 
+                        /*Memory of a thread for key tables, see ignis.modules.reduce.memory*/
+                        inline int64_t memoryBudget();
+
+                        template<typename Tp>
+                        inline int64_t estimateKeys(storage::IPartition<Tp> &part);
+
+                        /*Disk runs for a table of keys elements when max_keys fit in memory*/
+                        inline int64_t spillBuckets(int64_t keys, int64_t max_keys);
+
+                        template<typename Key, typename Value>
+                        inline void spillTable(IHashMap<Key, Value> &acum,
+                                               storage::IPartitionGroup<std::pair<Key, Value>> &runs, int64_t buckets,
+                                               int depth);
+
+                        /*bytes(elem, new_key) is the memory added by elem, runs over the budget are spilled again*/
+                        template<typename Key, typename Value, typename Function2, typename Bytes>
+                        inline void mergeSpills(IHashMap<Key, Value> &acum,
+                                                storage::IPartitionGroup<std::pair<Key, Value>> &runs,
+                                                api::IWriteIterator<std::pair<Key, Value>> &writer, Function2 merge,
+                                                Bytes bytes, int depth);
+
                     };
                 }// namespace impl
             }    // namespace modules
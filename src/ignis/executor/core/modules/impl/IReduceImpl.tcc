@@ -170,39 +170,63 @@ void IReduceImplClass::groupByKey(int64_t numPartitions) {
     auto input = executor_data->getAndDeletePartitions<Tp>();
     bool isMemory = executor_data->getPartitionTools().isMemory(*input);
     const bool cache = input->cache();
-    auto output =
-            executor_data->getPartitionTools()
-                    .newPartitionGroup<std::pair<typename Tp::first_type, api::IVector<typename Tp::second_type>>>(
-                            numPartitions);
+    typedef std::pair<typename Tp::first_type, api::IVector<typename Tp::second_type>> Group_Type;
+    auto output = executor_data->getPartitionTools().newPartitionGroup<Group_Type>(numPartitions);
+    const int64_t budget = memoryBudget();
+    const int64_t key_bytes = 2 * (sizeof(Group_Type) + sizeof(uint32_t));
+    const int64_t value_bytes = sizeof(typename Tp::second_type);
     IGNIS_LOG(info) << "Reduce: reducing key elements";
 
     IGNIS_OMP_EXCEPTION_INIT()
 #pragma omp parallel
     {
         IGNIS_OMP_TRY()
-        std::unordered_map<typename Tp::first_type, api::IVector<typename Tp::second_type>> acum;
+        IHashMap<typename Tp::first_type, api::IVector<typename Tp::second_type>> acum;
+        auto runs = executor_data->getPartitionTools().newPartitionGroup<Group_Type>(0);
+        int64_t values = 0;
+        int64_t buckets = 0;
+        auto group_elem = [&](Tp &elem) {
+            acum[std::move(elem.first)].push_back(std::move(elem.second));
+            values++;
+            if ((int64_t) acum.size() * key_bytes + values * value_bytes > budget) {
+                spillTable(acum, *runs, buckets, 0);
+                values = 0;
+            }
+        };
+        auto group_bytes = [&](Group_Type &elem, bool new_key) {
+            return (new_key ? key_bytes : 0) + (int64_t) elem.second.size() * value_bytes;
+        };
 
 #pragma omp for schedule(dynamic)
         for (int64_t p = 0; p < input->partitions(); p++) {
             auto &part = *(*input)[p];
+            auto keys = estimateKeys(part);
+            buckets = spillBuckets(keys, budget / key_bytes);
+            acum.reserve(std::min(keys, budget / key_bytes));
             if (isMemory) {
                 auto &men_part = executor_data->getPartitionTools().toMemory(part);
-                for (int64_t i = 0; i < men_part.size(); i++) {
-                    auto &elem = men_part[i];
-                    acum[std::move(elem.first)].push_back(std::move(elem.second));
-                }
-                auto writer = (*output)[p]->writeIterator();
+                for (int64_t i = 0; i < men_part.size(); i++) { group_elem(men_part[i]); }
+            } else {
+                auto reader = part.readIterator();
+                for (int64_t i = 0; i < part.size(); i++) { group_elem(reader->next()); }
+            }
+            auto writer = (*output)[p]->writeIterator();
+            if (runs->partitions() > 0) {
+                spillTable(acum, *runs, buckets, 0);
+                mergeSpills(
+                        acum, *runs, *writer,
+                        [](api::IVector<typename Tp::second_type> &acum_values,
+                           api::IVector<typename Tp::second_type> &values) {
+                            for (auto &value : values) { acum_values.push_back(std::move(value)); }
+                        },
+                        group_bytes, 0);
+            } else if (isMemory) {
                 auto &men_writer = executor_data->getPartitionTools().toMemory(*writer);
                 for (auto &elem : acum) { men_writer.write(std::move(elem)); }
             } else {
-                auto reader = part.readIterator();
-                for (int64_t i = 0; i < part.size(); i++) {
-                    auto &elem = reader->next();
-                    acum[std::move(elem.first)].push_back(std::move(elem.second));
-                }
-                auto writer = (*output)[p]->writeIterator();
                 for (auto &elem : acum) { writer->write(std::move(elem)); }
             }
+            values = 0;
             (*input)[p].reset();
             (*output)[p]->fit();
             acum.clear();
@@ -222,9 +246,14 @@ void IReduceImplClass::reduceByKey(int64_t numPartitions, bool localReduce) {
     f.before(context);
     if (localReduce) {
         IGNIS_LOG(info) << "Reduce: local reducing key elements";
-        localReduceByKey<Function, Tp>(f);
+        combineHashing<Tp, Tp>(
+                numPartitions, [](Tp &elem, bool cache) { return cache ? Tp(elem) : std::move(elem); },
+                [&](typename Tp::second_type &acum, typename Tp::second_type &value) {
+                    acum = f.call(acum, value, context);
+                });
+    } else {
+        keyHashing<Tp>(numPartitions);
     }
-    keyHashing<Tp>(numPartitions);
     keyExchanging<Tp>();
     IGNIS_LOG(info) << "Reduce: reducing key elements";
 
@@ -243,15 +272,40 @@ void IReduceImplClass::aggregateByKey(int64_t numPartitions, bool hashing) {
     if (hashing) {
         keyHashing<Tp>(numPartitions);
         keyExchanging<Tp>();
+        IGNIS_LOG(info) << "Reduce: aggregating key elements";
+        localAggregateByKey<Function, Tp>(f);
+    } else {
+        IGNIS_LOG(info) << "Reduce: local aggregating key elements";
+        typedef std::pair<typename Tp::first_type, typename Function::_R_type> Aggregate_Type;
+        auto base_acum = executor_data->getVariable<typename Function::_T1_type>("zero");
+        combineHashing<Tp, Aggregate_Type>(
+                numPartitions,
+                [&](Tp &elem, bool cache) {
+                    return Aggregate_Type(cache ? elem.first : std::move(elem.first),
+                                          f.call(base_acum, elem.second, context));
+                },
+                [&](typename Function::_R_type &acum, typename Tp::second_type &value) {
+                    acum = f.call(acum, value, context);
+                });
     }
-    IGNIS_LOG(info) << "Reduce: aggregating key elements";
-
-    localAggregateByKey<Function, Tp>(f);
     f.after(context);
 
     IGNIS_CATCH()
 }
 
+template<typename Tp, typename Function>
+void IReduceImplClass::mergeByKey() {
+    IGNIS_TRY()
+    auto &context = executor_data->getContext();
+    Function f;
+    f.before(context);
+    keyExchanging<Tp>();
+    IGNIS_LOG(info) << "Reduce: merging key elements";
+    localReduceByKey<Function, Tp>(f);
+    f.after(context);
+    IGNIS_CATCH()
+}
+
 template<typename Tp, typename Function>
 void IReduceImplClass::foldByKey(int64_t numPartitions, bool localFold) {
     IGNIS_TRY()
@@ -260,8 +314,17 @@ void IReduceImplClass::foldByKey(int64_t numPartitions, bool localFold) {
     f.before(context);
     if (localFold) {
         IGNIS_LOG(info) << "Reduce: local folding key elements";
-        localAggregateByKey<Function, Tp>(f);
-        keyHashing<Tp>(numPartitions);
+        typedef std::pair<typename Tp::first_type, typename Function::_R_type> Fold_Type;
+        auto base_acum = executor_data->getVariable<typename Function::_T1_type>("zero");
+        combineHashing<Tp, Fold_Type>(
+                numPartitions,
+                [&](Tp &elem, bool cache) {
+                    return Fold_Type(cache ? elem.first : std::move(elem.first),
+                                     f.call(base_acum, elem.second, context));
+                },
+                [&](typename Function::_R_type &acum, typename Tp::second_type &value) {
+                    acum = f.call(acum, value, context);
+                });
         keyExchanging<Tp>();
         IGNIS_LOG(info) << "Reduce: folding key elements";
         localReduceByKey<Function, Tp>(f);
@@ -345,14 +408,30 @@ void IReduceImplClass::union_(const std::string &other, bool preserveOrder) {
 template<typename Tp>
 void IReduceImplClass::join(const std::string &other, int64_t numPartitions) {
     IGNIS_TRY()
+    int side = broadcastSide(*executor_data->getPartitions<Tp>(),
+                             *executor_data->getVariable<std::shared_ptr<storage::IPartitionGroup<Tp>>>(other));
+    if (side > 0) {
+        broadcastJoin<Tp>(other, side == 1);
+        return;
+    }
+    IHashMap<typename Tp::first_type, int64_t> heavy;
+    heavyKeys<Tp>(numPartitions, heavy);
     IGNIS_LOG(info) << "Reduce: preparing first partitions";
-    keyHashing<Tp>(numPartitions);
+    if (heavy.empty()) {
+        keyHashing<Tp>(numPartitions);
+    } else {
+        skewHashing<Tp>(numPartitions, heavy, false);
+    }
     keyExchanging<Tp>();
     auto input = executor_data->getAndDeletePartitions<Tp>();
 
     IGNIS_LOG(info) << "Reduce: preparing second partitions";
     executor_data->setPartitions(executor_data->getVariable<decltype(input)>(other));
-    keyHashing<Tp>(numPartitions);
+    if (heavy.empty()) {
+        keyHashing<Tp>(numPartitions);
+    } else {
+        skewHashing<Tp>(numPartitions, heavy, true);
+    }
     keyExchanging<Tp>();
     auto input2 = executor_data->getAndDeletePartitions<Tp>();
 
@@ -365,7 +444,7 @@ void IReduceImplClass::join(const std::string &other, int64_t numPartitions) {
 #pragma omp parallel
     {
         IGNIS_OMP_TRY()
-        std::unordered_map<typename Tp::first_type, api::IVector<typename Tp::second_type>> acum;
+        IHashMap<typename Tp::first_type, api::IVector<typename Tp::second_type>> acum;
 #pragma omp for schedule(dynamic)
         for (int64_t p = 0; p < input->partitions(); p++) {
             auto writer = (*output)[p]->writeIterator();
@@ -395,6 +474,74 @@ void IReduceImplClass::join(const std::string &other, int64_t numPartitions) {
     IGNIS_CATCH()
 }
 
+template<typename Tp>
+int IReduceImplClass::broadcastSide(storage::IPartitionGroup<Tp> &first, storage::IPartitionGroup<Tp> &second) {
+    auto type = executor_data->getProperties().joinType();
+    if (type == "shuffle") { return 0; }
+    int64_t limit = executor_data->getProperties().joinBroadcast();
+    /*Broadcast is disabled, the sizes are not needed*/
+    if (type != "broadcast" && limit <= 0) { return 0; }
+    int64_t send[]{0, 0};
+    int64_t rcv[2];
+    for (auto part : first) { send[0] += part->bytes(); }
+    for (auto part : second) { send[1] += part->bytes(); }
+    executor_data->mpi().native().Allreduce(send, rcv, 2, MPI::LONG_LONG, MPI::SUM);
+    int side = rcv[0] < rcv[1] ? 1 : 2;
+    if (type == "broadcast") { return side; }
+    if (rcv[side - 1] <= limit) {
+        IGNIS_LOG(info) << "Reduce: join side " << side << " of " << rcv[side - 1] << " bytes will be broadcast";
+        return side;
+    }
+    return 0;
+}
+
+template<typename Tp>
+void IReduceImplClass::broadcastJoin(const std::string &other, bool first) {
+    auto input = executor_data->getAndDeletePartitions<Tp>();
+    auto input2 = executor_data->getVariable<decltype(input)>(other);
+    auto small = first ? input : input2;
+    auto large = first ? input2 : input;
+    typedef std::pair<typename Tp::second_type, typename Tp::second_type> Value_Type;
+    typedef std::pair<typename Tp::first_type, Value_Type> Return_Type;
+
+    IGNIS_LOG(info) << "Reduce: broadcasting " << (first ? "first" : "second") << " join partitions";
+    auto all = executor_data->getPartitionTools().newMemoryPartition<Tp>();
+    for (auto part : *small) { part->copyTo(*all); }
+    executor_data->mpi().allgather(*all);
+    IHashMap<typename Tp::first_type, api::IVector<typename Tp::second_type>> table;
+    for (auto &elem : *all) { table[std::move(elem.first)].push_back(std::move(elem.second)); }
+    all.reset();
+
+    IGNIS_LOG(info) << "Reduce: joining key elements with " << table.size() << " broadcast keys";
+    auto output = executor_data->getPartitionTools().newPartitionGroup<Return_Type>(large->partitions());
+    IGNIS_OMP_EXCEPTION_INIT()
+#pragma omp parallel
+    {
+        IGNIS_OMP_TRY()
+#pragma omp for schedule(dynamic)
+        for (int64_t p = 0; p < large->partitions(); p++) {
+            auto writer = (*output)[p]->writeIterator();
+            auto reader = (*large)[p]->readIterator();
+            /*The table is only read, threads can share it*/
+            while (reader->hasNext()) {
+                auto &elem = reader->next();
+                auto it = table.find(elem.first);
+                if (it == table.end()) { continue; }
+                for (const auto &value : it->second) {
+                    if (first) {
+                        writer->write(Return_Type(elem.first, Value_Type(value, elem.second)));
+                    } else {
+                        writer->write(Return_Type(elem.first, Value_Type(elem.second, value)));
+                    }
+                }
+            }
+        }
+        IGNIS_OMP_CATCH()
+    }
+    IGNIS_OMP_EXCEPTION_END()
+    executor_data->setPartitions(output);
+}
+
 template<typename Tp>
 void IReduceImplClass::distinct(int64_t numPartitions) {
     IGNIS_TRY()
@@ -571,44 +718,53 @@ void IReduceImplClass::localReduceByKey(Function &f) {
     }
 
     auto &context = executor_data->getContext();
+    const int64_t key_bytes = 2 * (sizeof(Tp) + sizeof(uint32_t));
+    const int64_t max_keys = std::max<int64_t>(1, memoryBudget() / key_bytes);
     IGNIS_OMP_EXCEPTION_INIT()
 #pragma omp parallel
     {
         IGNIS_OMP_TRY()
-        std::unordered_map<typename Tp::first_type, typename Tp::second_type> acum;
+        IHashMap<typename Tp::first_type, typename Tp::second_type> acum;
+        auto runs = executor_data->getPartitionTools().newPartitionGroup<Tp>(0);
+        int64_t buckets = 0;
+        auto reduce_elem = [&](Tp &elem) {
+            auto it = acum.find(elem.first);
+            if (it == acum.end()) {
+                acum.insert(it, std::move(elem));
+                if ((int64_t) acum.size() > max_keys) { spillTable(acum, *runs, buckets, 0); }
+            } else {
+                it->second = f.call(it->second, elem.second, context);
+            }
+        };
 
 #pragma omp for schedule(dynamic)
         for (int64_t p = 0; p < input->partitions(); p++) {
             auto &part_in = *(*input)[p];
             auto &part_out = *(*output)[p];
+            auto keys = estimateKeys(part_in);
+            buckets = spillBuckets(keys, max_keys);
+            acum.reserve(std::min(keys, max_keys));
             if (isMemory) {
                 auto &men_part = executor_data->getPartitionTools().toMemory(part_in);
-                for (int64_t i = 0; i < men_part.size(); i++) {
-                    auto &elem = men_part[i];
-                    auto it = acum.find(elem.first);
-                    if (it == acum.end()) {
-                        acum.insert(it, std::move(elem));
-                    } else {
-                        it->second = f.call(it->second, elem.second, context);
-                    }
-                }
-                part_out.clear();
-                auto writer = part_out.writeIterator();
+                for (int64_t i = 0; i < men_part.size(); i++) { reduce_elem(men_part[i]); }
+            } else {
+                auto reader = part_in.readIterator();
+                for (int64_t i = 0; i < part_in.size(); i++) { reduce_elem(reader->next()); }
+            }
+            part_out.clear();
+            auto writer = part_out.writeIterator();
+            if (runs->partitions() > 0) {
+                spillTable(acum, *runs, buckets, 0);
+                mergeSpills(
+                        acum, *runs, *writer,
+                        [&](typename Tp::second_type &acum_value, typename Tp::second_type &value) {
+                            acum_value = f.call(acum_value, value, context);
+                        },
+                        [&](Tp &elem, bool new_key) { return new_key ? key_bytes : 0; }, 0);
+            } else if (isMemory) {
                 auto &men_writer = executor_data->getPartitionTools().toMemory(*writer);
                 for (auto &elem : acum) { men_writer.write(std::move(elem)); }
             } else {
-                auto reader = part_in.readIterator();
-                for (int64_t i = 0; i < part_in.size(); i++) {
-                    auto &elem = reader->next();
-                    auto it = acum.find(elem.first);
-                    if (it == acum.end()) {
-                        acum.insert(it, std::move(elem));
-                    } else {
-                        it->second = f.call(it->second, elem.second, context);
-                    }
-                }
-                part_out.clear();
-                auto writer = part_out.writeIterator();
                 for (auto &elem : acum) { writer->write(std::move(elem)); }
             }
             acum.clear();
@@ -637,7 +793,7 @@ void IReduceImplClass::localAggregateByKey(Function &f) {
 #pragma omp parallel
     {
         IGNIS_OMP_TRY()
-        std::unordered_map<typename Tp::first_type, typename Function::_R_type> acum;
+        IHashMap<typename Tp::first_type, typename Function::_R_type> acum;
 
 #pragma omp for schedule(dynamic)
         for (int64_t p = 0; p < input->partitions(); p++) {
@@ -727,11 +883,93 @@ void IReduceImplClass::keyHashing(int64_t numPartitions) {
                     (*input)[p]->clear();
                 }
             } else {
+                readBatches(*(*input)[p],
+                            [&](Tp &elem) { writers[hash(elem.first) % numPartitions]->write(std::move(elem)); });
+                if (!cache) { (*input)[p]->clear(); }
+            }
+        }
+#pragma omp critical
+        for (int64_t p = 0; p < thread_ranges->partitions(); p++) { (*thread_ranges)[p]->moveTo(*((*output)[p])); }
+        IGNIS_OMP_CATCH()
+    }
+    IGNIS_OMP_EXCEPTION_END()
+    executor_data->setPartitions(output);
+}
+
+template<typename Tp>
+void IReduceImplClass::heavyKeys(int64_t numPartitions, IHashMap<typename Tp::first_type, int64_t> &heavy) {
+    double skew = executor_data->getProperties().reduceSkew();
+    if (skew == 0 || numPartitions < 2) { return; }
+    auto input = executor_data->getPartitions<Tp>();
+    auto samples = selectSamples(*input, 64);
+    auto keys = executor_data->getPartitionTools().newMemoryPartition<typename Tp::first_type>(samples->size());
+    auto writer = keys->writeIterator();
+    for (auto &elem : *samples) { writer->write(std::move(elem.first)); }
+    samples.reset();
+    IGNIS_LOG(info) << "Reduce: collecting key samples";
+    executor_data->mpi().gather(*keys, 0);
+
+    auto splits = executor_data->getPartitionTools().newMemoryPartition<std::pair<typename Tp::first_type, int64_t>>();
+    if (executor_data->mpi().isRoot(0) && keys->size() > 0) {
+        IHashMap<typename Tp::first_type, int64_t> counts;
+        for (auto &key : *keys) { counts[key]++; }
+        auto splits_writer = splits->writeIterator();
+        for (auto &entry : counts) {
+            double share = (double) entry.second / keys->size();
+            /*Each heavy key gets enough partitions to have an average share in every one*/
+            int64_t parts = std::min<int64_t>(numPartitions, std::ceil(share * numPartitions));
+            if (share > skew && parts > 1) { splits_writer->write(std::make_pair(entry.first, parts)); }
+        }
+    }
+    executor_data->mpi().bcast(*splits, 0);
+    for (auto &entry : *splits) { heavy.insert(std::move(entry)); }
+    IGNIS_LOG(info) << "Reduce: " << heavy.size() << " heavy keys found";
+}
+
+template<typename Tp>
+void IReduceImplClass::skewHashing(int64_t numPartitions, IHashMap<typename Tp::first_type, int64_t> &heavy,
+                                   bool replicate) {
+    auto input = executor_data->getPartitions<Tp>();
+    auto output = executor_data->getPartitionTools().newPartitionGroup<Tp>(numPartitions);
+    const bool cache = input->cache();
+    const std::hash<typename Tp::first_type> hash;
+    IGNIS_LOG(info) << "Reduce: creating " << numPartitions << " new partitions with key hashing, "
+                    << (replicate ? "replicating" : "splitting") << " heavy keys";
+
+    IGNIS_OMP_EXCEPTION_INIT()
+#pragma omp parallel
+    {
+        IGNIS_OMP_TRY()
+        auto thread_ranges = executor_data->getPartitionTools().newPartitionGroup<Tp>(output->partitions());
+        std::vector<std::shared_ptr<api::IWriteIterator<Tp>>> writers;
+        for (int64_t p = 0; p < thread_ranges->partitions(); p++) {
+            writers.push_back((*thread_ranges)[p]->writeIterator());
+        }
+        int64_t salt = 0;
+        /*A heavy key uses the partitions following its own, one side is split and the other is sent to all of them*/
+        auto route = [&](Tp &elem) {
+            auto target = hash(elem.first) % numPartitions;
+            auto it = heavy.find(elem.first);
+            if (it == heavy.end()) {
+                writers[target]->write(std::move(elem));
+            } else if (replicate) {
+                for (int64_t i = 1; i < it->second; i++) { writers[(target + i) % numPartitions]->write(elem); }
+                writers[target]->write(std::move(elem));
+            } else {
+                writers[(target + salt++ % it->second) % numPartitions]->write(std::move(elem));
+            }
+        };
+#pragma omp for schedule(dynamic)
+        for (int64_t p = 0; p < input->partitions(); p++) {
+            if (cache) {
+                auto reader = (*input)[p]->readIterator();
                 while (reader->hasNext()) {
-                    auto &elem = reader->next();
-                    writers[hash(elem.first) % numPartitions]->write(std::move(elem));
+                    Tp elem = reader->next();
+                    route(elem);
                 }
-                if (!cache) { (*input)[p]->clear(); }
+            } else {
+                readBatches(*(*input)[p], route);
+                (*input)[p]->clear();
             }
         }
 #pragma omp critical
@@ -742,6 +980,65 @@ void IReduceImplClass::keyHashing(int64_t numPartitions) {
     executor_data->setPartitions(output);
 }
 
+template<typename Tp, typename Tp2, typename Create, typename Combine>
+void IReduceImplClass::combineHashing(int64_t numPartitions, Create create, Combine combine) {
+    auto input = executor_data->getPartitions<Tp>();
+    auto output = executor_data->getPartitionTools().newPartitionGroup<Tp2>(numPartitions);
+    const bool in_men = executor_data->getPartitionTools().isMemory(*input);
+    const bool cache = input->cache();
+    const std::hash<typename Tp::first_type> hash;
+    const int64_t max_keys = std::max<int64_t>(1, memoryBudget() / (2 * (sizeof(Tp2) + sizeof(uint32_t))));
+    IGNIS_LOG(info) << "Reduce: combining keys in " << numPartitions << " new partitions with key hashing";
+
+    IGNIS_OMP_EXCEPTION_INIT()
+#pragma omp parallel
+    {
+        IGNIS_OMP_TRY()
+        /*A table for each target partition, elements are combined and partitioned in the same pass*/
+        std::vector<IHashMap<typename Tp2::first_type, typename Tp2::second_type>> acums(numPartitions);
+        int64_t keys = 0;
+        auto thread_ranges = executor_data->getPartitionTools().newPartitionGroup<Tp2>(output->partitions());
+        std::vector<std::shared_ptr<api::IWriteIterator<Tp2>>> writers;
+        for (int64_t p = 0; p < thread_ranges->partitions(); p++) {
+            writers.push_back((*thread_ranges)[p]->writeIterator());
+        }
+        auto flush = [&]() {
+            for (int64_t p = 0; p < numPartitions; p++) {
+                for (auto &elem : acums[p]) { writers[p]->write(std::move(elem)); }
+                acums[p].clear();
+            }
+            keys = 0;
+        };
+        auto combine_elem = [&](Tp &elem) {
+            auto &acum = acums[hash(elem.first) % numPartitions];
+            auto it = acum.find(elem.first);
+            if (it == acum.end()) {
+                acum.insert(it, create(elem, cache));
+                /*Partial results are valid, the final reduce merges them*/
+                if (++keys > max_keys) { flush(); }
+            } else {
+                combine(it->second, elem.second);
+            }
+        };
+#pragma omp for schedule(dynamic)
+        for (int64_t p = 0; p < input->partitions(); p++) {
+            if (in_men) {
+                auto &men_part = executor_data->getPartitionTools().toMemory(*(*input)[p]);
+                for (int64_t i = 0; i < men_part.size(); i++) { combine_elem(men_part[i]); }
+            } else {
+                readBatches(*(*input)[p], combine_elem);
+            }
+            if (!cache) { (*input)[p]->clear(); }
+        }
+        flush();
+#pragma omp critical
+        for (int64_t p = 0; p < thread_ranges->partitions(); p++) { (*thread_ranges)[p]->moveTo(*((*output)[p])); }
+        IGNIS_OMP_CATCH()
+    }
+    IGNIS_OMP_EXCEPTION_END()
+    executor_data->setPartitions(output);
+}
+
 template<typename Tp>
 void IReduceImplClass::keyExchanging() {
     auto input = executor_data->getPartitions<Tp>();
@@ -762,7 +1059,7 @@ inline void IReduceImplClass::distinctFilter(storage::IPartitionGroup<Tp> &parts
 #pragma omp parallel
     {
         IGNIS_OMP_TRY()
-        std::unordered_set<Tp> distinct;
+        IHashSet<Tp> distinct;
 #pragma omp for schedule(dynamic)
         for (int64_t p = 0; p < parts.partitions(); p++) {
             auto new_part = executor_data->getPartitionTools().newPartition<Tp>();
@@ -771,22 +1068,12 @@ inline void IReduceImplClass::distinctFilter(storage::IPartitionGroup<Tp> &parts
                 auto &men_part = executor_data->getPartitionTools().toMemory(*parts[p]);
                 for (int64_t i = 0; i < men_part.size(); i++) {
                     auto &elem = men_part[i];
-                    auto it = distinct.find(elem);
-                    if(it == distinct.end()){
-                        writer->write(elem);
-                    }
-                    distinct.insert(elem);
+                    if (distinct.insert(elem).second) { writer->write(elem); }
                 }
             }else{
-                auto reader = parts[p]->readIterator();
-                while (reader->hasNext()) {
-                    auto &elem = reader->next();
-                    auto it = distinct.find(elem);
-                    if(it == distinct.end()){
-                        writer->write(elem);
-                    }
-                    distinct.insert(elem);
-                }
+                readBatches(*parts[p], [&](Tp &elem) {
+                    if (distinct.insert(elem).second) { writer->write(std::move(elem)); }
+                });
             }
             parts[p] = new_part;
             distinct.clear();
@@ -796,4 +1083,93 @@ inline void IReduceImplClass::distinctFilter(storage::IPartitionGroup<Tp> &parts
     IGNIS_OMP_EXCEPTION_END()
 }
 
+inline int64_t IReduceImplClass::memoryBudget() {
+    int64_t memory = executor_data->getProperties().reduceMemory();
+    if (memory == 0) { return std::numeric_limits<int64_t>::max(); }
+    return std::max<int64_t>(1, memory / executor_data->getCores());
+}
+
+template<typename Tp>
+inline int64_t IReduceImplClass::estimateKeys(storage::IPartition<Tp> &part) {
+    /*Only memory partitions can be read twice for free, the others let the table grow*/
+    if (part.type() != storage::IMemoryPartition<Tp>::TYPE || part.size() < 4096) { return 0; }
+    auto &men_part = executor_data->getPartitionTools().toMemory(part);
+    const std::hash<typename Tp::first_type> hash;
+    IHyperLogLog hll;
+    for (int64_t i = 0; i < men_part.size(); i++) { hll.add(hash(men_part[i].first)); }
+    return std::min<int64_t>(hll.estimate(), part.size());
+}
+
+inline int64_t IReduceImplClass::spillBuckets(int64_t keys, int64_t max_keys) {
+    /*Twice the buckets the estimate needs, a bucket that still does not fit is split again when it is merged*/
+    int64_t buckets = 2 * ((keys + max_keys - 1) / max_keys);
+    return std::min<int64_t>(std::max<int64_t>(buckets, 16), 4096);
+}
+
+template<typename Key, typename Value>
+inline void IReduceImplClass::spillTable(IHashMap<Key, Value> &acum,
+                                         storage::IPartitionGroup<std::pair<Key, Value>> &runs, int64_t buckets,
+                                         int depth) {
+    /*Runs are split by key hash, so each one can be merged alone*/
+    const std::hash<Key> hash;
+    if (runs.partitions() == 0) {
+        for (int64_t i = 0; i < buckets; i++) {
+            runs.add(executor_data->getPartitionTools().newDiskPartition<std::pair<Key, Value>>());
+        }
+    }
+    buckets = runs.partitions();
+    std::vector<std::shared_ptr<api::IWriteIterator<std::pair<Key, Value>>>> writers;
+    for (int64_t i = 0; i < buckets; i++) { writers.push_back(runs[i]->writeIterator()); }
+    /*A seed for each depth, keys of a bucket are spread again when it is split. The bits are also different from
+     * the ones used by the table and by the key partitioner*/
+    for (auto &elem : acum) {
+        uint64_t h = (uint64_t) hash(elem.first) ^ ((uint64_t) depth * 0x9E3779B97F4A7C15ull);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        writers[h % buckets]->write(std::move(elem));
+    }
+    acum.clear();
+}
+
+template<typename Key, typename Value, typename Function2, typename Bytes>
+inline void IReduceImplClass::mergeSpills(IHashMap<Key, Value> &acum,
+                                          storage::IPartitionGroup<std::pair<Key, Value>> &runs,
+                                          api::IWriteIterator<std::pair<Key, Value>> &writer, Function2 merge,
+                                          Bytes bytes, int depth) {
+    IGNIS_LOG(info) << "Reduce: merging " << runs.partitions() << " spilled runs";
+    const int64_t budget = memoryBudget();
+    /*Keys with the same hash cannot be split, at some point the bucket is merged whatever its size*/
+    const bool split = depth < 4;
+    for (int64_t i = 0; i < runs.partitions(); i++) {
+        auto sub_runs = executor_data->getPartitionTools().newPartitionGroup<std::pair<Key, Value>>(0);
+        int64_t used = 0;
+        readBatches(*runs[i], [&](std::pair<Key, Value> &elem) {
+            auto it = acum.find(elem.first);
+            if (it == acum.end()) {
+                used += bytes(elem, true);
+                acum.insert(it, std::move(elem));
+            } else {
+                used += bytes(elem, false);
+                merge(it->second, elem.second);
+            }
+            if (split && used > budget) {
+                spillTable(acum, *sub_runs, 16, depth + 1);
+                used = 0;
+            }
+        });
+        runs[i]->clear();
+        if (sub_runs->partitions() > 0) {
+            spillTable(acum, *sub_runs, 16, depth + 1);
+            mergeSpills(acum, *sub_runs, writer, merge, bytes, depth + 1);
+        } else {
+            for (auto &elem : acum) { writer.write(std::move(elem)); }
+            acum.clear();
+        }
+    }
+    runs.clear();
+}
+
 #undef IReduceImplClass
\ No newline at end of file
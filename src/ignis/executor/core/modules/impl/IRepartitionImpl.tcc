@@ -349,11 +349,8 @@ void IRepartitionImplClass::partitionBy_impl(Particioner f, int64_t numPartition
                         writers[((size_t) f(men_part[i])) % numPartitions]->write(men_part[i]);
                     }
                 } else {
-                    auto reader = (*input)[p]->readIterator();
-                    for (size_t i = 0; i < sz; i++) {
-                        auto &elem = reader->next();
-                        writers[((size_t) f(elem)) % numPartitions]->write(elem);
-                    }
+                    readBatches(*(*input)[p],
+                                [&](Tp &elem) { writers[((size_t) f(elem)) % numPartitions]->write(std::move(elem)); });
                 }
                 (*input)[p].reset();
             }
@@ -63,13 +63,28 @@ namespace ignis {
                         template<typename Tp, typename Function>
                         void sortByKeyBy(bool ascending, int64_t partitions);
 
+                        /*Join both inputs by key ranges, only the values of one key are kept in memory. Each partition
+                         * is still sorted in memory, so a single partition must fit in memory*/
+                        template<typename Tp>
+                        void mergeJoin(const std::string &other, int64_t partitions);
+
                     private:
+                        /*Default comparators, sortPartition can use a radix sort with them*/
+                        template<typename Tp>
+                        struct ILess;
+
+                        template<typename Tp>
+                        struct IKeyLess;
+
+                        template<typename Tp, typename Enable = void>
+                        struct IRadixKey;
+
                         /*Primary Functions*/
                         template<typename Tp, typename Cmp>
                         void sort_impl(Cmp comparator, int64_t partitions, bool local_sort=true);
 
                         template<typename Tp, typename Cmp>
-                        void parallelLocalSort(storage::IPartitionGroup<Tp> &group, Cmp comparator);
+                        void parallelLocalSort(storage::IPartitionGroup<Tp> &group, Cmp comparator, bool merge = false);
 
                         template<typename Tp>
                         std::shared_ptr<storage::IMemoryPartition<Tp>> selectPivots(storage::IPartitionGroup<Tp> &group,
@@ -83,13 +98,31 @@ namespace ignis {
                         generateRanges(storage::IPartitionGroup<Tp> &group, storage::IMemoryPartition<Tp> &pivots,
                                        Cmp comparator);
 
+                        template<typename Tp, typename Cmp>
+                        std::shared_ptr<storage::IPartitionGroup<Tp>>
+                        exchangeRanges(std::shared_ptr<storage::IPartitionGroup<Tp>> input,
+                                       storage::IMemoryPartition<Tp> &pivots, Cmp comparator);
+
                         /*Auxiliary functions*/
                         template<typename Tp, typename Cmp>
-                        void sortPartition(storage::IMemoryPartition<Tp> &part, Cmp comparator);
+                        void sortPartition(storage::IMemoryPartition<Tp> &part, Cmp comparator, int64_t threads);
+
+                        template<typename Tp>
+                        void sortPartition(storage::IMemoryPartition<Tp> &part, ILess<Tp> comparator, int64_t threads);
 
                         template<typename Tp>
-                        std::shared_ptr<storage::IMemoryPartition<Tp>>
-                        selectMemoryPivots(storage::IPartitionGroup<Tp> &group, int64_t samples);
+                        void sortPartition(storage::IMemoryPartition<Tp> &part, IKeyLess<Tp> comparator,
+                                           int64_t threads);
+
+                        template<typename Tp, typename Cmp>
+                        void mergePartition(storage::IMemoryPartition<Tp> &part, Cmp comparator, int64_t threads);
+
+                        template<typename Tp, typename Cmp>
+                        void mergeRuns(Tp *input, std::vector<std::pair<int64_t, int64_t>> &runs, Tp *output,
+                                       Cmp comparator);
+
+                        template<typename Tp, typename Digit>
+                        void radixSort(storage::IMemoryPartition<Tp> &part, int bytes, Digit digit, int64_t threads);
 
                         template<typename Tp, typename Cmp>
                         std::shared_ptr<storage::IPartitionGroup<Tp>>
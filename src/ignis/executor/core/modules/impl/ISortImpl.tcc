@@ -2,6 +2,8 @@
 #include "ISortImpl.h"
 #include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <type_traits>
 
 #define ISortImplClass ignis::executor::core::modules::impl::ISortImpl
 
@@ -14,9 +16,7 @@ void ISortImplClass::sort(bool ascending) {
 template<typename Tp>
 void ISortImplClass::sort(bool ascending, int64_t partitions) {
     IGNIS_TRY()
-    std::less<Tp> comparator;
-    sort_impl<Tp>([&comparator, ascending](const Tp &lhs, const Tp &rhs) { return comparator(lhs, rhs) == ascending; },
-                  partitions);
+    sort_impl<Tp>(ILess<Tp>{ascending}, partitions);
     IGNIS_CATCH()
 }
 
@@ -144,10 +144,7 @@ void ISortImplClass::sortByKey(bool ascending) {
 template<typename Tp>
 void ISortImplClass::sortByKey(bool ascending, int64_t partitions) {
     IGNIS_TRY()
-    std::less<typename Tp::first_type> comparator;
-    sort_impl<Tp>([&comparator, ascending](const Tp &lhs,
-                                           const Tp &rhs) { return comparator(lhs.first, rhs.first) == ascending; },
-                  partitions);
+    sort_impl<Tp>(IKeyLess<Tp>{ascending}, partitions);
     IGNIS_CATCH()
 }
 
@@ -171,6 +168,110 @@ void ISortImplClass::sortByKeyBy(bool ascending, int64_t partitions) {
     IGNIS_CATCH()
 }
 
+template<typename Tp>
+void ISortImplClass::mergeJoin(const std::string &other, int64_t partitions) {
+    IGNIS_TRY()
+    auto input = executor_data->getAndDeletePartitions<Tp>();
+    auto input2 = executor_data->getVariable<decltype(input)>(other);
+    auto comparator = IKeyLess<Tp>{true};
+    typedef std::pair<typename Tp::second_type, typename Tp::second_type> Value_Type;
+    typedef std::pair<typename Tp::first_type, Value_Type> Return_Type;
+
+    IGNIS_LOG(info) << "Sort: sorting join partitions locally";
+    for (auto group : {&input, &input2}) {
+        if ((*group)->cache()) {
+            *group = executor_data->getPartitionTools().isMemory(**group) ? (*group)->clone() : (*group)->shadowCopy();
+        }
+        parallelLocalSort(**group, comparator);
+    }
+
+    /*Both inputs use the same pivots, so partition p of each one has the same key range*/
+    auto samples = selectPivots(*input, partitions);
+    auto samples2 = selectPivots(*input2, partitions);
+    samples2->moveTo(*samples);
+    samples2.reset();
+    IGNIS_LOG(info) << "Sort: collecting join pivots";
+    executor_data->mpi().gather(*samples, 0);
+    auto pivots = samples;
+    if (executor_data->mpi().isRoot(0)) {
+        auto group = executor_data->getPartitionTools().newPartitionGroup<Tp>(0);
+        group->add(samples);
+        parallelLocalSort(*group, comparator);
+        pivots = selectPivots(*group, partitions - 1);
+    }
+    executor_data->mpi().bcast(*pivots, 0);
+
+    IGNIS_LOG(info) << "Sort: exchanging join ranges";
+    auto left = exchangeRanges(input, *pivots, comparator);
+    input.reset();
+    auto right = exchangeRanges(input2, *pivots, comparator);
+    input2.reset();
+
+    IGNIS_LOG(info) << "Sort: merging " << left->partitions() << " join partitions";
+    auto output = executor_data->getPartitionTools().newPartitionGroup<Return_Type>(left->partitions());
+    IGNIS_OMP_EXCEPTION_INIT()
+#pragma omp parallel
+    {
+        IGNIS_OMP_TRY()
+        api::IVector<typename Tp::second_type> values;
+#pragma omp for schedule(dynamic)
+        for (int64_t p = 0; p < left->partitions(); p++) {
+            auto writer = (*output)[p]->writeIterator();
+            auto left_it = (*left)[p]->readIterator();
+            auto right_it = (*right)[p]->readIterator();
+            Tp l, r;
+            bool has_l = left_it->hasNext(), has_r = right_it->hasNext();
+            if (has_l) { l = std::move(left_it->next()); }
+            if (has_r) { r = std::move(right_it->next()); }
+            while (has_l && has_r) {
+                if (comparator(l, r)) {
+                    if ((has_l = left_it->hasNext())) { l = std::move(left_it->next()); }
+                } else if (comparator(r, l)) {
+                    if ((has_r = right_it->hasNext())) { r = std::move(right_it->next()); }
+                } else {
+                    /*Elements are sorted, a key ends with the first element that the comparator puts after it*/
+                    Tp key(l.first, typename Tp::second_type());
+                    values.clear();
+                    while (has_l && !comparator(key, l)) {
+                        values.push_back(std::move(l.second));
+                        if ((has_l = left_it->hasNext())) { l = std::move(left_it->next()); }
+                    }
+                    while (has_r && !comparator(key, r)) {
+                        for (const auto &value : values) {
+                            writer->write(Return_Type(key.first, Value_Type(value, r.second)));
+                        }
+                        if ((has_r = right_it->hasNext())) { r = std::move(right_it->next()); }
+                    }
+                }
+            }
+            (*left)[p].reset();
+            (*right)[p].reset();
+        }
+        IGNIS_OMP_CATCH()
+    }
+    IGNIS_OMP_EXCEPTION_END()
+    executor_data->setPartitions(output);
+    IGNIS_CATCH()
+}
+
+template<typename Tp, typename Cmp>
+std::shared_ptr<ignis::executor::core::storage::IPartitionGroup<Tp>>
+ISortImplClass::exchangeRanges(std::shared_ptr<storage::IPartitionGroup<Tp>> input,
+                               storage::IMemoryPartition<Tp> &pivots, Cmp comparator) {
+    std::shared_ptr<storage::IPartitionGroup<Tp>> ranges;
+    if (pivots.empty()) {
+        ranges = executor_data->getPartitionTools().newPartitionGroup<Tp>(1);
+        for (auto part : *input) { part->moveTo(*(*ranges)[0]); }
+    } else {
+        ranges = generateRanges(*input, pivots, comparator);
+    }
+    auto output = executor_data->getPartitionTools().newPartitionGroup<Tp>();
+    exchange<Tp>(*ranges, *output);
+    ranges.reset();
+    parallelLocalSort(*output, comparator, true);
+    return output;
+}
+
 template<typename Tp, typename Cmp>
 void ISortImplClass::sort_impl(Cmp comparator, int64_t partitions, bool local_sort) {
     auto input = executor_data->getPartitions<Tp>();
@@ -255,28 +356,39 @@ void ISortImplClass::sort_impl(Cmp comparator, int64_t partitions, bool local_so
     IGNIS_LOG(info) << "Sort: exchanging ranges";
     exchange<Tp>(*ranges, *output);
 
-    /*Sort final partitions*/
-    IGNIS_LOG(info) << "Sort: sorting again " << output->partitions() << " partitions locally";
-    parallelLocalSort(*output, comparator);
+    /*Each range arrives as sorted runs, merging them is cheaper than sorting again*/
+    IGNIS_LOG(info) << "Sort: merging " << output->partitions() << " partitions locally";
+    parallelLocalSort(*output, comparator, true);
     executor_data->setPartitions(output);
 }
 
 template<typename Tp, typename Cmp>
-void ISortImplClass::parallelLocalSort(storage::IPartitionGroup<Tp> &group, Cmp comparator) {
+void ISortImplClass::parallelLocalSort(storage::IPartitionGroup<Tp> &group, Cmp comparator, bool merge) {
     bool inMemory = executor_data->getPartitionTools().isMemory(group);
+    /*With fewer partitions than cores, each partition is sorted using all of them*/
+    int64_t threads = group.partitions() < executor_data->getCores() ? executor_data->getCores() : 1;
     IGNIS_OMP_EXCEPTION_INIT()
-#pragma omp parallel
+#pragma omp parallel if (threads == 1)
     {
         IGNIS_OMP_TRY()
 /*Sort each partition locally*/
 #pragma omp for schedule(dynamic)
         for (int64_t p = 0; p < group.partitions(); p++) {
             if (inMemory) {
-                sortPartition<Tp>(executor_data->getPartitionTools().toMemory(*group[p]), comparator);
+                auto &part = executor_data->getPartitionTools().toMemory(*group[p]);
+                if (merge) {
+                    mergePartition<Tp>(part, comparator, threads);
+                } else {
+                    sortPartition<Tp>(part, comparator, threads);
+                }
             } else {
                 storage::IMemoryPartition<Tp> tmp(group[p]->size());
                 group[p]->copyTo(tmp);
-                sortPartition<Tp>(tmp, comparator);
+                if (merge) {
+                    mergePartition<Tp>(tmp, comparator, threads);
+                } else {
+                    sortPartition<Tp>(tmp, comparator, threads);
+                }
                 group[p] = executor_data->getPartitionTools().newPartition(tmp);
                 group[p]->copyFrom(tmp);
             }
@@ -289,37 +401,7 @@ void ISortImplClass::parallelLocalSort(storage::IPartitionGroup<Tp> &group, Cmp
 template<typename Tp>
 std::shared_ptr<ignis::executor::core::storage::IMemoryPartition<Tp>>
 ISortImplClass::selectPivots(storage::IPartitionGroup<Tp> &group, int64_t samples) {
-    if (executor_data->getPartitionTools().isMemory(group)) { return selectMemoryPivots(group, samples); }
-    auto pivots = executor_data->getPartitionTools().newMemoryPartition<Tp>();
-    auto writer = pivots->writeIterator();
-    IGNIS_OMP_EXCEPTION_INIT()
-#pragma omp parallel
-    {
-        IGNIS_OMP_TRY()
-#pragma omp for schedule(dynamic)
-        for (int64_t p = 0; p < group.partitions(); p++) {
-            if (group[p]->size() < samples) {
-                group[p]->copyTo(*pivots);
-                writer = pivots->writeIterator();
-                continue;
-            }
-
-            auto skip = (group[p]->size() - samples) / (samples + 1);
-            auto rem = (group[p]->size() - samples) % (samples + 1);
-            auto reader = group[p]->readIterator();
-            for (int64_t n = 0; n < samples; n++) {
-                for (int64_t i = 0; i < skip; i++) {
-                    reader->next();
-                }
-                if (n < rem) { reader->next(); }
-#pragma omp critical
-                { writer->write(reader->next()); }
-            }
-        }
-        IGNIS_OMP_CATCH()
-    }
-    IGNIS_OMP_EXCEPTION_END()
-    return pivots;
+    return selectSamples(group, samples);
 }
 
 template<typename Tp>
@@ -389,11 +471,8 @@ ISortImplClass::generateRanges(storage::IPartitionGroup<Tp> &group, storage::IMe
 
 #pragma omp for schedule(dynamic)
         for (int64_t p = 0; p < group.partitions(); p++) {
-            auto reader = group[p]->readIterator();
-            while (reader->hasNext()) {
-                auto &elem = reader->next();
-                writers[searchRange(elem, pivots, comparator)]->write(elem);
-            }
+            readBatches(*group[p],
+                        [&](Tp &elem) { writers[searchRange(elem, pivots, comparator)]->write(std::move(elem)); });
             group[p].reset();
         }
 #pragma omp critical
@@ -407,37 +486,275 @@ ISortImplClass::generateRanges(storage::IPartitionGroup<Tp> &group, storage::IMe
 
 
 template<typename Tp, typename Cmp>
-void ISortImplClass::sortPartition(storage::IMemoryPartition<Tp> &part, Cmp comparator) {
-    std::sort(part.begin(), part.end(), comparator);
+void ISortImplClass::sortPartition(storage::IMemoryPartition<Tp> &part, Cmp comparator, int64_t threads) {
+    int64_t n = part.size();
+    if (threads < 2 || n < threads * 4096) {
+        std::sort(part.begin(), part.end(), comparator);
+        return;
+    }
+    /*Sort a block per thread and merge them in pairs*/
+    auto data = part.begin();
+    std::vector<int64_t> bounds;
+    for (int64_t t = 0; t <= threads; t++) { bounds.push_back(n * t / threads); }
+    IGNIS_OMP_EXCEPTION_INIT()
+#pragma omp parallel num_threads(threads)
+    {
+        IGNIS_OMP_TRY()
+#pragma omp for schedule(static)
+        for (int64_t t = 0; t < threads; t++) { std::sort(data + bounds[t], data + bounds[t + 1], comparator); }
+        for (int64_t width = 1; width < threads; width *= 2) {
+#pragma omp for schedule(dynamic)
+            for (int64_t t = 0; t < threads - width; t += 2 * width) {
+                std::inplace_merge(data + bounds[t], data + bounds[t + width],
+                                   data + bounds[std::min(t + 2 * width, threads)], comparator);
+            }
+        }
+        IGNIS_OMP_CATCH()
+    }
+    IGNIS_OMP_EXCEPTION_END()
 }
 
 template<typename Tp>
-std::shared_ptr<ignis::executor::core::storage::IMemoryPartition<Tp>>
-ISortImplClass::selectMemoryPivots(storage::IPartitionGroup<Tp> &group, int64_t samples) {
-    auto pivots = executor_data->getPartitionTools().newMemoryPartition<Tp>();
-    auto writer = pivots->writeIterator();
-    auto &men_writer = executor_data->getPartitionTools().toMemory(*writer);
-
-    for (int64_t p = 0; p < group.partitions(); p++) {
-        if (group[p]->size() < samples) {
-            auto &men_part = executor_data->getPartitionTools().toMemory(*(group[p]));
-            for (auto &elem : men_part) { men_writer.write(elem); }
-            continue;
+void ISortImplClass::sortPartition(storage::IMemoryPartition<Tp> &part, ILess<Tp> comparator, int64_t threads) {
+    if (!IRadixKey<Tp>::radix || part.size() < 256) {
+        sortPartition<Tp, ILess<Tp>>(part, comparator, threads);
+        return;
+    }
+    bool ascending = comparator.ascending;
+    radixSort(
+            part, IRadixKey<Tp>::bytes,
+            [ascending](const Tp &elem, int byte) {
+                uint8_t digit = IRadixKey<Tp>::digit(elem, byte);
+                return ascending ? digit : (uint8_t) ~digit;
+            },
+            threads);
+}
+
+template<typename Tp>
+void ISortImplClass::sortPartition(storage::IMemoryPartition<Tp> &part, IKeyLess<Tp> comparator, int64_t threads) {
+    /*Only contiguous pairs, larger values are cheaper to sort with a comparator*/
+    if (!IRadixKey<Tp>::radix || part.size() < 256) {
+        sortPartition<Tp, IKeyLess<Tp>>(part, comparator, threads);
+        return;
+    }
+    bool ascending = comparator.ascending;
+    radixSort(
+            part, IRadixKey<typename Tp::first_type>::bytes,
+            [ascending](const Tp &elem, int byte) {
+                uint8_t digit = IRadixKey<typename Tp::first_type>::digit(elem.first, byte);
+                return ascending ? digit : (uint8_t) ~digit;
+            },
+            threads);
+}
+
+template<typename Tp, typename Cmp>
+void ISortImplClass::mergePartition(storage::IMemoryPartition<Tp> &part, Cmp comparator, int64_t threads) {
+    int64_t n = part.size();
+    auto data = part.begin();
+    /*Find the sorted runs, equal neighbours never split a run even if the comparator is not strict*/
+    std::vector<int64_t> bounds{0};
+    for (int64_t i = 1; i < n; i++) {
+        if (comparator(data[i], data[i - 1]) && !comparator(data[i - 1], data[i])) { bounds.push_back(i); }
+    }
+    bounds.push_back(n);
+    int64_t k = bounds.size() - 1;
+    if (k < 2) { return; }
+    if (threads < 2 || n < threads * 4096) { threads = 1; }
+
+    /*Output is split using samples of every run, run co-ranks are found with a binary search of each splitter*/
+    std::vector<std::vector<int64_t>> cuts(threads + 1, std::vector<int64_t>(k));
+    for (int64_t i = 0; i < k; i++) {
+        cuts[0][i] = bounds[i];
+        cuts[threads][i] = bounds[i + 1];
+    }
+    if (threads > 1) {
+        std::vector<Tp> samples;
+        for (int64_t i = 0; i < k; i++) {
+            int64_t len = bounds[i + 1] - bounds[i];
+            for (int64_t s = 1; s <= threads; s++) { samples.push_back(data[bounds[i] + len * s / (threads + 1)]); }
+        }
+        std::sort(samples.begin(), samples.end(), comparator);
+        for (int64_t t = 1; t < threads; t++) {
+            const Tp &splitter = samples[samples.size() * t / threads];
+            for (int64_t i = 0; i < k; i++) {
+                cuts[t][i] = std::lower_bound(data + cuts[t - 1][i], data + bounds[i + 1], splitter, comparator) - data;
+            }
         }
+    }
 
-        auto skip = (group[p]->size() - samples) / (samples + 1);
-        auto rem = (group[p]->size() - samples) % (samples + 1);
-        auto &part = executor_data->getPartitionTools().toMemory(*group[p]);
-        auto pos = skip + (rem > 0 ? 1 : 0);
-        for (int64_t n = 0; n < samples; n++) {
-            men_writer.write(part[pos++]);
-            pos += skip;
-            if (n < rem - 1) { pos++; }
+    api::IVector<Tp> result(n);
+    auto output = reinterpret_cast<Tp *>(&result[0]);
+    IGNIS_OMP_EXCEPTION_INIT()
+#pragma omp parallel num_threads(threads)
+    {
+        IGNIS_OMP_TRY()
+#pragma omp for schedule(static)
+        for (int64_t t = 0; t < threads; t++) {
+            std::vector<std::pair<int64_t, int64_t>> runs;
+            int64_t offset = 0;
+            for (int64_t i = 0; i < k; i++) {
+                offset += cuts[t][i] - bounds[i];
+                runs.emplace_back(cuts[t][i], cuts[t + 1][i]);
+            }
+            mergeRuns(data, runs, output + offset, comparator);
+        }
+        IGNIS_OMP_CATCH()
+    }
+    IGNIS_OMP_EXCEPTION_END()
+    std::swap(part.inner(), result);
+}
+
+template<typename Tp, typename Cmp>
+void ISortImplClass::mergeRuns(Tp *input, std::vector<std::pair<int64_t, int64_t>> &runs, Tp *output,
+                               Cmp comparator) {
+    /*Loser tree, tree[0] is the winner and each inner node keeps the loser of its match*/
+    int64_t k = runs.size();
+    int64_t n = 0;
+    for (auto &run : runs) { n += run.second - run.first; }
+    auto wins = [&](int64_t a, int64_t b) {
+        if (runs[a].first == runs[a].second) { return false; }
+        if (runs[b].first == runs[b].second) { return true; }
+        return comparator(input[runs[a].first], input[runs[b].first]);
+    };
+    std::vector<int64_t> tree(k, -1);
+    for (int64_t i = 0; i < k; i++) {
+        int64_t winner = i;
+        for (int64_t node = (i + k) / 2; node > 0 && winner >= 0; node /= 2) {
+            if (tree[node] < 0) {
+                tree[node] = winner;
+                winner = -1;
+            } else if (wins(tree[node], winner)) {
+                std::swap(tree[node], winner);
+            }
         }
+        if (winner >= 0) { tree[0] = winner; }
     }
-    return pivots;
+    for (int64_t j = 0; j < n; j++) {
+        int64_t winner = tree[0];
+        output[j] = std::move(input[runs[winner].first++]);
+        for (int64_t node = (winner + k) / 2; node > 0; node /= 2) {
+            if (wins(tree[node], winner)) { std::swap(tree[node], winner); }
+        }
+        tree[0] = winner;
+    }
+}
+
+template<typename Tp, typename Digit>
+void ISortImplClass::radixSort(storage::IMemoryPartition<Tp> &part, int bytes, Digit digit, int64_t threads) {
+    /*LSD radix sort, one byte per pass. Each block counts its digits so the scatter is stable and parallel*/
+    int64_t n = part.size();
+    int64_t blocks = std::max((int64_t) 1, std::min(threads, n / 4096));
+    api::IVector<Tp> buffer(n);
+    auto src = part.begin();
+    auto dst = reinterpret_cast<Tp *>(&buffer[0]);
+    bool swapped = false;
+    std::vector<int64_t> offsets(blocks * 256);
+
+    for (int byte = 0; byte < bytes; byte++) {
+        bool skip = false;
+#pragma omp parallel num_threads(blocks) if (blocks > 1)
+        {
+#pragma omp for schedule(static)
+            for (int64_t b = 0; b < blocks; b++) {
+                auto count = &offsets[b * 256];
+                std::fill(count, count + 256, 0);
+                for (int64_t i = n * b / blocks; i < n * (b + 1) / blocks; i++) { count[digit(src[i], byte)]++; }
+            }
+#pragma omp single
+            {
+                int64_t pos = 0;
+                for (int d = 0; d < 256; d++) {
+                    int64_t start = pos;
+                    for (int64_t b = 0; b < blocks; b++) {
+                        auto count = offsets[b * 256 + d];
+                        offsets[b * 256 + d] = pos;
+                        pos += count;
+                    }
+                    /*All elements share the digit in every block, nothing to do*/
+                    if (pos - start == n) { skip = true; }
+                }
+            }
+            if (!skip) {
+#pragma omp for schedule(static)
+                for (int64_t b = 0; b < blocks; b++) {
+                    auto offset = &offsets[b * 256];
+                    for (int64_t i = n * b / blocks; i < n * (b + 1) / blocks; i++) {
+                        dst[offset[digit(src[i], byte)]++] = std::move(src[i]);
+                    }
+                }
+            }
+        }
+        if (!skip) {
+            std::swap(src, dst);
+            swapped = !swapped;
+        }
+    }
+    if (swapped) { std::swap(part.inner(), buffer); }
 }
 
+template<typename Tp>
+struct ISortImplClass::ILess {
+    bool ascending;
+
+    bool operator()(const Tp &lhs, const Tp &rhs) const { return std::less<Tp>()(lhs, rhs) == ascending; }
+};
+
+template<typename Tp>
+struct ISortImplClass::IKeyLess {
+    bool ascending;
+
+    bool operator()(const Tp &lhs, const Tp &rhs) const {
+        return std::less<typename Tp::first_type>()(lhs.first, rhs.first) == ascending;
+    }
+};
+
+/*Maps each type to an unsigned key with the same order, byte 0 is the least significant*/
+template<typename Tp, typename Enable>
+struct ISortImplClass::IRadixKey {
+    static const bool radix = false;
+    static const int bytes = 0;
+
+    static inline uint8_t digit(const Tp &elem, int byte) { return 0; }
+};
+
+template<typename Tp>
+struct ISortImplClass::IRadixKey<Tp, typename std::enable_if<std::is_integral<Tp>::value>::type> {
+    static const bool radix = true;
+    static const int bytes = sizeof(Tp);
+
+    static inline uint8_t digit(const Tp &elem, int byte) {
+        auto key = (uint64_t) elem;
+        if (std::is_signed<Tp>::value) { key ^= (uint64_t) 1 << (sizeof(Tp) * 8 - 1); }
+        return (uint8_t) (key >> (byte * 8));
+    }
+};
+
+template<typename Tp>
+struct ISortImplClass::IRadixKey<Tp, typename std::enable_if<std::is_floating_point<Tp>::value &&
+                                                              (sizeof(Tp) == 4 || sizeof(Tp) == 8)>::type> {
+    static const bool radix = true;
+    static const int bytes = sizeof(Tp);
+
+    static inline uint8_t digit(const Tp &elem, int byte) {
+        typedef typename std::conditional<sizeof(Tp) == 4, uint32_t, uint64_t>::type Bits;
+        Bits key;
+        std::memcpy(&key, &elem, sizeof(Tp));
+        Bits sign = (Bits) 1 << (sizeof(Tp) * 8 - 1);
+        key = (key & sign) ? ~key : key | sign;
+        return (uint8_t) (key >> (byte * 8));
+    }
+};
+
+template<typename T1, typename T2>
+struct ISortImplClass::IRadixKey<std::pair<T1, T2>, void> {
+    static const bool radix = IRadixKey<T1>::radix && IRadixKey<T2>::radix;
+    static const int bytes = IRadixKey<T1>::bytes + IRadixKey<T2>::bytes;
+
+    static inline uint8_t digit(const std::pair<T1, T2> &elem, int byte) {
+        if (byte < IRadixKey<T2>::bytes) { return IRadixKey<T2>::digit(elem.second, byte); }
+        return IRadixKey<T1>::digit(elem.first, byte - IRadixKey<T2>::bytes);
+    }
+};
 
 template<typename Tp, typename Cmp>
 std::shared_ptr<ignis::executor::core::storage::IPartitionGroup<Tp>>
@@ -460,38 +777,22 @@ ISortImplClass::generateMemoryRanges(storage::IPartitionGroup<Tp> &group, storag
         for (int64_t p = 0; p < group.partitions(); p++) {
             auto &part = executor_data->getPartitionTools().toMemory(*group[p]);
             if (part.empty()) { continue; }
-            std::vector<std::pair<int64_t, int64_t>> elems_stack;
-            std::vector<std::pair<int64_t, int64_t>> ranges_stack;
-
-            elems_stack.emplace_back(0, group[p]->size() - 1);
-            ranges_stack.emplace_back(0, pivots.size());
-
-            while (!elems_stack.empty()) {
-                int64_t start = elems_stack.back().first;
-                int64_t end = elems_stack.back().second;
-                int64_t mid = (start + end) / 2;
-                elems_stack.pop_back();
-
-                int64_t firt = ranges_stack.back().first;
-                int64_t last = ranges_stack.back().second;
-                ranges_stack.pop_back();
-
-                int64_t r = searchRange(part[mid], pivots, comparator);
-                writers[r]->write(std::move(part[mid]));
-
-                if (firt == r) {
-                    for (int64_t i = start; i < mid; i++) { writers[r]->write(std::move(part[i])); }
-                } else if (start < mid) {
-                    elems_stack.emplace_back(start, mid - 1);
-                    ranges_stack.emplace_back(firt, r);
-                }
-
-                if (r == last) {
-                    for (int64_t i = mid + 1; i <= end; i++) { writers[r]->write(std::move(part[i])); }
-                } else if (mid < end) {
-                    elems_stack.emplace_back(mid + 1, end);
-                    ranges_stack.emplace_back(r, last);
+            /*The partition is sorted, so each range is a slice and is written as a sorted run*/
+            int64_t first = 0;
+            for (int64_t r = 0; r < ranges->partitions() && first < part.size(); r++) {
+                int64_t last = first;
+                int64_t count = part.size() - first;
+                while (count > 0) {
+                    int64_t step = count / 2;
+                    if (searchRange(part[last + step], pivots, comparator) <= r) {
+                        last += step + 1;
+                        count -= step + 1;
+                    } else {
+                        count = step;
+                    }
                 }
+                for (int64_t i = first; i < last; i++) { writers[r]->write(std::move(part[i])); }
+                first = last;
             }
             group[p].reset();
         }
@@ -556,12 +857,12 @@ void ISortImplClass::take_ordered_impl(Cmp comparator, int64_t n) {
     IGNIS_OMP_EXCEPTION_END()
 
     IGNIS_LOG(info) << "Sort: local executor top/takeOrdered";
-    sortPartition(*top, comparator);
+    sortPartition(*top, comparator, 1);
     top->resize(n);
     IGNIS_LOG(info) << "Sort: global top/takeOrdered";
     executor_data->mpi().gather(*top, 0);
     if (executor_data->mpi().isRoot(0)) {
-        sortPartition(*top, comparator);
+        sortPartition(*top, comparator, 1);
         top->resize(n);
         output->add(top);
     }
@@ -32,6 +32,8 @@ namespace ignis {
                         error();
                     };
 
+                    virtual void mergeByKey(modules::impl::IReduceImpl &impl) { error(); };
+
 
                 private:
                     inline void error() {
@@ -61,6 +63,8 @@ namespace ignis {
                         foldByKey_check<Tp>(impl, nullptr, numPartitions, localFold);
                     };
 
+                    virtual void mergeByKey(modules::impl::IReduceImpl &impl) { mergeByKey_check<Tp>(impl, nullptr); };
+
                 private:
                     template<typename Function>
                     void mapValues_check(modules::impl::IPipeImpl &impl, typename Function::_IFunction_type *val) {
@@ -151,6 +155,24 @@ namespace ignis {
                     void foldByKey_check(...) {
                         throw exception::ICompatibilyException("foldByKey", RTTInfo::from<Function>());
                     }
+
+                    template<typename Function>
+                    void mergeByKey_check(modules::impl::IReduceImpl &impl, typename Function::_IFunction2_type *val) {
+                        mergeByKey_check<Function>(impl, (typename Function::_T1_type *) nullptr,
+                                                   (typename Function::_T1_type *) nullptr, nullptr);
+                    }
+
+                    template<typename Function>
+                    void mergeByKey_check(modules::impl::IReduceImpl &impl, typename Function::_T2_type *val2,
+                                          typename Function::_R_type *val3,
+                                          decltype(&std::hash<typename Function::_T1_type>::operator()) *val4) {
+                        impl.mergeByKey<std::pair<K, typename Function::_T1_type>, Function>();
+                    }
+
+                    template<typename Function>
+                    void mergeByKey_check(...) {
+                        throw exception::ICompatibilyException("mergeByKey", RTTInfo::from<Function>());
+                    }
                 };
 
             }// namespace selector
@@ -56,6 +56,9 @@ namespace ignis {
                     virtual void join(modules::impl::IReduceImpl &impl, const std::string &other,
                                       int64_t numPartitions) = 0;
 
+                    virtual void mergeJoin(modules::impl::ISortImpl &impl, const std::string &other,
+                                           int64_t numPartitions) = 0;
+
                     virtual void distinct(modules::impl::IReduceImpl &impl, int64_t numPartitions) = 0;
 
                     virtual void repartition(modules::impl::IRepartitionImpl &impl, int64_t numPartitions,
@@ -177,6 +180,11 @@ namespace ignis {
                         join_check<Tp>(impl, nullptr, other, numPartitions);
                     }
 
+                    virtual void mergeJoin(modules::impl::ISortImpl &impl, const std::string &other,
+                                           int64_t numPartitions) {
+                        mergeJoin_check<Tp>(impl, nullptr, other, numPartitions);
+                    }
+
                     virtual void distinct(modules::impl::IReduceImpl &impl, int64_t numPartitions) {
                         distinct_check<Tp>(impl, nullptr, numPartitions);
                     }
@@ -296,6 +304,18 @@ namespace ignis {
                         throw exception::ICompatibilyException("join", RTTInfo::from<C>());
                     }
 
+                    template<typename C>
+                    void mergeJoin_check(modules::impl::ISortImpl &impl,
+                                         typename IHasLess<typename C::first_type>::result val,
+                                         const std::string &other, int64_t numPartitions) {
+                        impl.mergeJoin<Tp>(other, numPartitions);
+                    }
+
+                    template<typename C>
+                    void mergeJoin_check(...) {
+                        throw exception::ICompatibilyException("mergeJoin", RTTInfo::from<C>());
+                    }
+
                     template<typename C>
                     void distinct_check(modules::impl::IReduceImpl &impl, typename IHasHash<C>::result,
                                         int64_t numPartitions) {
@@ -18,6 +18,8 @@ namespace ignis {
 
                     virtual std::shared_ptr<IPartition<Tp>> clone();
 
+                    virtual void copyFrom(IPartition<Tp> &source);
+
                     virtual void clear();
 
                     virtual void fit();
@@ -52,6 +54,8 @@ namespace ignis {
                     std::string path;
                     std::string header;
                     bool destroy;
+                    /*Shared with the mapped readers, the file is not truncated while they are alive*/
+                    std::shared_ptr<bool> mapping;
                 };
             }// namespace storage
         }    // namespace core
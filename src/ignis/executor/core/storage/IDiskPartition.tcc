@@ -3,7 +3,10 @@
 #include <ghc/filesystem.hpp>
 #include "ignis/executor/core/exception/IInvalidArgument.h"
 #include "ignis/executor/core/transport/IHeaderTransport.h"
+#include "ignis/executor/core/transport/IMappedBuffer.h"
 #include "ignis/executor/core/transport/IMemoryBuffer.h"
+#include "ignis/executor/core/transport/IPipe.h"
+#include <thrift/transport/TBufferTransports.h>
 
 #define IDiskPartitionClass ignis::executor::core::storage::IDiskPartition
 
@@ -19,7 +22,7 @@ template<typename Tp>
 IDiskPartitionClass<Tp>::IDiskPartition(std::shared_ptr<transport::IFileTransport> &&trans, std::string &path,
                                         int8_t compression, bool persist, bool read)
     : IRawPartition<Tp>((std::shared_ptr<transport::ITransport> &) trans, compression), path(path), file(trans),
-      destroy(!persist){
+      destroy(!persist), mapping(std::make_shared<bool>()){
     /*Flush out zlib header*/
     transport::IFileTransport tmp(path, false, true);
     uint8_t byte = 0;
@@ -52,11 +55,32 @@ std::shared_ptr<ignis::executor::core::storage::IPartition<Tp>> IDiskPartitionCl
     return newPartition;
 }
 
+template<typename Tp>
+void IDiskPartitionClass<Tp>::copyFrom(IPartition<Tp> &source) {
+    if (source.type() == TYPE && reinterpret_cast<IDiskPartition<Tp> &>(source).compression == this->compression) {
+        auto &disk_source = reinterpret_cast<IDiskPartition<Tp> &>(source);
+        disk_source.sync();
+        sync();
+        transport::IFileTransport source_file(disk_source.path, true, false);
+        transport::IPipe::copyFile(source_file.getFD(), file->getFD());
+        this->elems += disk_source.elems;
+    } else {
+        IRawPartition<Tp>::copyFrom(source);
+    }
+}
+
 template<typename Tp>
 void IDiskPartitionClass<Tp>::clear() {
     this->zlib->flush();
     this->elems = 0;
-    if (::ftruncate64(file->getFD(), 0) != 0) {
+    if (mapping.use_count() > 1) {
+        /*A reader still maps the file and would fault on truncated pages, the mapping keeps the old file*/
+        std::remove(path.c_str());
+        transport::IFileTransport tmp(path, false, true);
+        int aux = tmp.getFD();
+        tmp.setFD(file->getFD());
+        file->setFD(aux);
+    } else if (::ftruncate64(file->getFD(), 0) != 0) {
         throw exception::ILogicError("error: " + path + " truncate error");
     }
     sync();
@@ -135,8 +159,13 @@ void IDiskPartitionClass<Tp>::writeHeader() {
 
 template<typename Tp>
 std::shared_ptr<ignis::executor::core::transport::ITransport> IDiskPartitionClass<Tp>::readTransport() {
+    std::shared_ptr<transport::ITransport> mapped = transport::IMappedBuffer::map(path, mapping);
+    if (mapped) { return std::make_shared<transport::IHeaderTransport>(mapped, header); }
     auto file_trans = std::make_shared<transport::IFileTransport>(path, true, false);
-    return std::make_shared<transport::IHeaderTransport>((std::shared_ptr<transport::ITransport> &) file_trans, header);
+    /*Uncompressed readers ask for a few bytes at a time*/
+    std::shared_ptr<transport::ITransport> buffered = std::make_shared<apache::thrift::transport::TBufferedTransport>(
+            file_trans, transport::IPipe::bufferSize(), 0);
+    return std::make_shared<transport::IHeaderTransport>(buffered, header);
 }
 
 template<typename Tp>
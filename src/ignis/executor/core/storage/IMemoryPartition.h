@@ -71,6 +71,8 @@ namespace ignis {
 
                     bool hasNext();
 
+                    int64_t readBatch(Tp *out, int64_t n);
+
                     virtual ~IMemoryReadIterator();
 
                 private:
@@ -87,6 +89,8 @@ namespace ignis {
 
                     void write(Tp &&obj);
 
+                    void writeBatch(Tp *in, int64_t n);
+
                     virtual ~IMemoryWriteIterator();
 
                 private:
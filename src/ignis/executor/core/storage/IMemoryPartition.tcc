@@ -2,6 +2,7 @@
 #include "IMemoryPartition.h"
 #include "ignis/executor/core/protocol/IObjectProtocol.h"
 #include "ignis/executor/core/transport/IZlibTransport.h"
+#include <algorithm>
 #include <utility>
 
 #define IMemoryPartitionClass ignis::executor::core::storage::IMemoryPartition
@@ -61,7 +62,9 @@ void IMemoryPartitionClass<Tp>::copyFrom(IPartition<Tp> &source) {
         std::copy(men_source.begin(), men_source.end(), std::back_inserter(elements));
     } else {
         auto it = source.readIterator();
-        for (int64_t i = 0; i < source.size(); i++) { elements.push_back(std::move(it->next())); }
+        auto init = elements.size();
+        elements.resize(init + source.size());
+        it->readBatch(begin() + init, source.size());
     }
 }
 
@@ -73,7 +76,9 @@ void IMemoryPartitionClass<Tp>::moveFrom(IPartition<Tp> &source) {
         source.clear();
     } else {
         auto it = source.readIterator();
-        for (int64_t i = 0; i < source.size(); i++) { elements.push_back(std::move(it->next())); }
+        auto init = elements.size();
+        elements.resize(init + source.size());
+        it->readBatch(begin() + init, source.size());
     }
 }
 
@@ -151,6 +156,17 @@ bool IMemoryReadIteratorClass<Tp>::hasNext() {
     return elements.size() > index;
 }
 
+template<typename Tp>
+int64_t IMemoryReadIteratorClass<Tp>::readBatch(Tp *out, int64_t n) {
+    n = std::min(n, (int64_t) elements.size() - index);
+    if (n <= 0) { return 0; }
+    auto first = reinterpret_cast<Tp *>(&elements[index]);
+    /*std::copy is a memmove for trivially copyable types*/
+    std::copy(first, first + n, out);
+    index += n;
+    return n;
+}
+
 template<typename Tp>
 IMemoryReadIteratorClass<Tp>::~IMemoryReadIterator() {}
 
@@ -167,6 +183,12 @@ void IMemoryWriteIteratorClass<Tp>::write(Tp &&obj) {
     elements.emplace_back(std::forward<Tp>(obj));
 }
 
+template<typename Tp>
+void IMemoryWriteIteratorClass<Tp>::writeBatch(Tp *in, int64_t n) {
+    if (n <= 0) { return; }
+    elements.insert(elements.end(), in, in + n);
+}
+
 template<typename Tp>
 IMemoryWriteIteratorClass<Tp>::~IMemoryWriteIterator() {}
 
@@ -114,10 +114,13 @@ namespace ignis {
 
                 template<typename Tp>
                 inline int64_t copy(api::IReadIterator<Tp> &reader, api::IWriteIterator<Tp> &writer) {
+                    IVector<Tp> batch(256);
+                    auto data = reinterpret_cast<Tp *>(&batch[0]);
                     int64_t n = 0;
-                    while (reader.hasNext()) {
-                        writer.write(reader.next());
-                        n++;
+                    int64_t read;
+                    while ((read = reader.readBatch(data, batch.size())) > 0) {
+                        writer.writeBatch(data, read);
+                        n += read;
                     }
                     return n;
                 }
@@ -5,6 +5,7 @@
 #include "IPartition.h"
 #include "ignis/executor/core/protocol/IObjectProtocol.h"
 #include "ignis/executor/core/transport/IZlibTransport.h"
+#include <type_traits>
 
 namespace ignis {
     namespace executor {
@@ -68,6 +69,20 @@ namespace ignis {
                     void write(protocol::IProtocol &proto, size_t elems);
                 };
 
+                /*Prepares the slot of IRawReadIterator to be read in place keeping the memory of its containers*/
+                template<typename Tp>
+                struct IRawSlot {
+                    void reset(Tp &slot);
+                };
+
+                /*Types whose compact encoding is their memory representation, batches are copied as bytes*/
+                template<typename Tp>
+                struct isRawCopy
+                    : std::integral_constant<bool, std::is_same<Tp, int8_t>::value ||
+                                                           std::is_same<Tp, uint8_t>::value ||
+                                                           (std::is_same<Tp, double>::value &&
+                                                            __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)> {};
+
                 template<typename Tp>
                 class IRawReadIterator : public api::IReadIterator<Tp> {
                 public:
@@ -79,14 +94,20 @@ namespace ignis {
 
                     bool hasNext();
 
+                    int64_t readBatch(Tp *out, int64_t n);
+
                     virtual ~IRawReadIterator();
 
                 private:
+                    void readBatch(Tp *out, int64_t n, std::true_type);
+
+                    void readBatch(Tp *out, int64_t n, std::false_type);
+
                     std::shared_ptr<protocol::IProtocol> proto;
-                    std::shared_ptr<Tp> shared;
+                    Tp slot;//reused by next(), valid until the following call
                     size_t pos;
                     size_t &elems;
-                    io::IReader<std::shared_ptr<Tp>> reader;
+                    io::IReader<Tp> reader;
                 };
 
                 template<typename Tp>
@@ -98,9 +119,15 @@ namespace ignis {
 
                     void write(Tp &&obj);
 
+                    void writeBatch(Tp *in, int64_t n);
+
                     virtual ~IRawWriteIterator();
 
                 private:
+                    void writeBatch(Tp *in, int64_t n, std::true_type);
+
+                    void writeBatch(Tp *in, int64_t n, std::false_type);
+
                     std::shared_ptr<protocol::IProtocol> proto;
                     size_t &elems;
                     io::IWriter<Tp> writer;
@@ -1,8 +1,12 @@
 
 #include "IRawPartition.h"
+#include "IMemoryPartition.h"
+#include "ignis/executor/core/transport/IPipe.h"
+#include <climits>
 
 #define IRawPartitionClass ignis::executor::core::storage::IRawPartition
 #define IHeaderClass ignis::executor::core::storage::IHeader
+#define IRawSlotClass ignis::executor::core::storage::IRawSlot
 #define IRawReadIteratorClass ignis::executor::core::storage::IRawReadIterator
 #define IRawWriteIteratorClass ignis::executor::core::storage::IRawWriteIterator
 
@@ -19,10 +23,7 @@ void IRawPartitionClass<Tp>::read(std::shared_ptr<transport::ITransport> &trans)
     auto zlib_in = std::make_shared<transport::IZlibTransport>(trans);
     this->readHeader(reinterpret_cast<std::shared_ptr<transport::ITransport> &>(zlib_in));
     this->sync();
-
-    uint8_t bb[256];
-    uint32_t read;
-    while ((read = zlib_in->read(bb, 256)) > 0) { this->zlib->write(bb, read); }
+    transport::IPipe::copy(*zlib_in, *this->zlib);
 }
 
 template<typename Tp>
@@ -30,15 +31,13 @@ void IRawPartitionClass<Tp>::write(std::shared_ptr<transport::ITransport> &trans
     this->sync();
     auto source = readTransport();
 
-    uint8_t bb[256];
-    uint32_t read;
     if (compression == this->compression) {
-        while ((read = source->read(bb, 256)) > 0) { trans->write(bb, read); }
+        transport::IPipe::copy(*source, *trans);
         trans->flush();
     } else {
         auto zlib = std::make_shared<transport::IZlibTransport>(source);
         auto zlib_out = std::make_shared<transport::IZlibTransport>(trans, compression);
-        while ((read = zlib->read(bb, 256)) > 0) { zlib_out->write(bb, read); }
+        transport::IPipe::copy(*zlib, *zlib_out);
         zlib_out->flush();
     }
 }
@@ -91,14 +90,11 @@ void IRawPartitionClass<Tp>::copyFrom(IPartition<Tp> &source) {
         raw_source.sync();
         sync();
         this->elems += raw_source.elems;
-        uint8_t bb[256];
-        uint32_t read;
         /*Direct copy*/
         if (raw_source.compression == this->compression) {
             auto source_buffer = raw_source.readTransport();
-            source_buffer->read(bb, raw_source.header_size);//skip header
-            auto &target = transport();
-            while ((read = source_buffer->read(bb, 256)) > 0) { target->write(bb, read); }
+            source_buffer->read(&transport::IPipe::buffer()[0], raw_source.header_size);//skip header
+            transport::IPipe::copy(*source_buffer, *transport());
         } else {
             /*Read header to initialize zlib*/
             auto source_buffer = raw_source.readTransport();
@@ -106,8 +102,11 @@ void IRawPartitionClass<Tp>::copyFrom(IPartition<Tp> &source) {
             auto source_proto = std::make_shared<protocol::IObjectProtocol>(source_zlib);
             source_proto->readSerialization();
             IHeader<Tp>().read(*source_proto);
-            while ((read = source_zlib->read(bb, 256)) > 0) { this->zlib->write(bb, read); }
+            transport::IPipe::copy(*source_zlib, *this->zlib);
         }
+    } else if (source.type() == "Memory") {
+        auto &men_source = reinterpret_cast<IMemoryPartition<Tp> &>(source);
+        this->writeIterator()->writeBatch(men_source.begin(), men_source.size());
     } else {
         auto reader = source.readIterator();
         auto writer = this->writeIterator();
@@ -167,6 +166,70 @@ struct IHeaderClass<std::pair<H1, H2>> {
     }
 };
 
+template<typename Tp>
+void IRawSlotClass<Tp>::reset(Tp &slot) {
+    slot = Tp();
+}
+
+template<>
+struct IRawSlotClass<std::string> {
+    void reset(std::string &slot) {}
+};
+
+template<typename _Tp, typename _Alloc>
+struct IRawSlotClass<std::vector<_Tp, _Alloc>> {
+    void reset(std::vector<_Tp, _Alloc> &slot) { slot.clear(); }
+};
+
+template<typename _Tp, typename _Alloc>
+struct IRawSlotClass<std::list<_Tp, _Alloc>> {
+    void reset(std::list<_Tp, _Alloc> &slot) { slot.clear(); }
+};
+
+template<typename _Tp, typename _Alloc>
+struct IRawSlotClass<std::forward_list<_Tp, _Alloc>> {
+    void reset(std::forward_list<_Tp, _Alloc> &slot) { slot.clear(); }
+};
+
+template<typename _Key, typename _Compare, typename _Alloc>
+struct IRawSlotClass<std::set<_Key, _Compare, _Alloc>> {
+    void reset(std::set<_Key, _Compare, _Alloc> &slot) { slot.clear(); }
+};
+
+template<typename _Value, typename _Hash, typename _Pred, typename _Alloc>
+struct IRawSlotClass<std::unordered_set<_Value, _Hash, _Pred, _Alloc>> {
+    void reset(std::unordered_set<_Value, _Hash, _Pred, _Alloc> &slot) { slot.clear(); }
+};
+
+template<typename _Key, typename _Tp, typename _Compare, typename _Alloc>
+struct IRawSlotClass<std::map<_Key, _Tp, _Compare, _Alloc>> {
+    void reset(std::map<_Key, _Tp, _Compare, _Alloc> &slot) { slot.clear(); }
+};
+
+template<typename _Key, typename _Tp, typename _Hash, typename _Pred, typename _Alloc>
+struct IRawSlotClass<std::unordered_map<_Key, _Tp, _Hash, _Pred, _Alloc>> {
+    void reset(std::unordered_map<_Key, _Tp, _Hash, _Pred, _Alloc> &slot) { slot.clear(); }
+};
+
+template<typename _T1, typename _T2>
+struct IRawSlotClass<std::pair<_T1, _T2>> {
+    void reset(std::pair<_T1, _T2> &slot) {
+        IRawSlotClass<_T1>().reset(slot.first);
+        IRawSlotClass<_T2>().reset(slot.second);
+    }
+};
+
+/*Pointers returned by next() belong to the caller, each element is read into a new object*/
+template<typename _Tp>
+struct IRawSlotClass<_Tp *> {
+    void reset(_Tp *&slot) { slot = new _Tp(); }
+};
+
+template<typename _Tp>
+struct IRawSlotClass<std::shared_ptr<_Tp>> {
+    void reset(std::shared_ptr<_Tp> &slot) { slot = std::make_shared<_Tp>(); }
+};
+
 template<typename Tp>
 IRawReadIteratorClass<Tp>::IRawReadIterator(std::shared_ptr<protocol::IProtocol> proto, size_t &elems)
     : proto(proto), elems(elems), pos(0) {}
@@ -174,14 +237,15 @@ IRawReadIteratorClass<Tp>::IRawReadIterator(std::shared_ptr<protocol::IProtocol>
 template<typename Tp>
 Tp &IRawReadIteratorClass<Tp>::next() {
     pos++;
-    shared = reader(*proto);
-    return *shared;
+    IRawSlot<Tp>().reset(slot);
+    reader(*proto, slot);
+    return slot;
 }
 
 template<typename Tp>
 std::shared_ptr<Tp> IRawReadIteratorClass<Tp>::nextShared() {
     pos++;
-    return shared = reader(*proto);
+    return std::make_shared<Tp>(reader(*proto));
 }
 
 template<typename Tp>
@@ -189,6 +253,32 @@ bool IRawReadIteratorClass<Tp>::hasNext() {
     return pos < elems;
 }
 
+template<typename Tp>
+int64_t IRawReadIteratorClass<Tp>::readBatch(Tp *out, int64_t n) {
+    n = std::min(n, (int64_t) (elems - pos));
+    if (n <= 0) { return 0; }
+    readBatch(out, n, isRawCopy<Tp>());
+    pos += n;
+    return n;
+}
+
+template<typename Tp>
+void IRawReadIteratorClass<Tp>::readBatch(Tp *out, int64_t n, std::true_type) {
+    auto data = reinterpret_cast<uint8_t *>(out);
+    size_t bytes = n * sizeof(Tp);
+    while (bytes > 0) {
+        uint32_t len = std::min<size_t>(bytes, INT_MAX);
+        proto->getTransport()->readAll(data, len);
+        data += len;
+        bytes -= len;
+    }
+}
+
+template<typename Tp>
+void IRawReadIteratorClass<Tp>::readBatch(Tp *out, int64_t n, std::false_type) {
+    for (int64_t i = 0; i < n; i++) { out[i] = reader(*proto); }
+}
+
 template<typename Tp>
 IRawReadIteratorClass<Tp>::~IRawReadIterator() {}
 
@@ -208,9 +298,35 @@ void IRawWriteIteratorClass<Tp>::write(Tp &&obj) {
     elems++;
 }
 
+template<typename Tp>
+void IRawWriteIteratorClass<Tp>::writeBatch(Tp *in, int64_t n) {
+    if (n <= 0) { return; }
+    writeBatch(in, n, isRawCopy<Tp>());
+    elems += n;
+}
+
+template<typename Tp>
+void IRawWriteIteratorClass<Tp>::writeBatch(Tp *in, int64_t n, std::true_type) {
+    auto data = reinterpret_cast<const uint8_t *>(in);
+    size_t bytes = n * sizeof(Tp);
+    while (bytes > 0) {
+        uint32_t len = std::min<size_t>(bytes, INT_MAX);
+        proto->getTransport()->write(data, len);
+        data += len;
+        bytes -= len;
+    }
+}
+
+template<typename Tp>
+void IRawWriteIteratorClass<Tp>::writeBatch(Tp *in, int64_t n, std::false_type) {
+    for (int64_t i = 0; i < n; i++) { writer(*proto, in[i]); }
+}
+
 template<typename Tp>
 IRawWriteIteratorClass<Tp>::~IRawWriteIterator() {}
 
 #undef IRawPartitionClass
+#undef IHeaderClass
+#undef IRawSlotClass
 #undef IRawReadIteratorClass
 #undef IRawWriteIteratorClass
\ No newline at end of file
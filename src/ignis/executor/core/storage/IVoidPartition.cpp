@@ -1,6 +1,7 @@
 
 #include "IVoidPartition.h"
 #include "ignis/executor/core/exception/ILogicError.h"
+#include "ignis/executor/core/transport/IPipe.h"
 #include "ignis/executor/core/transport/IZlibTransport.h"
 
 using namespace ignis::executor;
@@ -23,12 +24,10 @@ std::shared_ptr<api::IWriteIterator<IVoidPartition::VOID_TYPE>> IVoidPartition::
 }
 
 void IVoidPartition::read(std::shared_ptr<transport::ITransport> &trans) {
-    uint8_t bb[256];
-    uint32_t read;
     if (path.empty()) {
-        while ((read = trans->read(bb, 256)) > 0) { buffer->write(bb, read); }
+        transport::IPipe::copy(*trans, *buffer);
     } else {
-        while ((read = trans->read(bb, 256)) > 0) { file->write(bb, read); }
+        transport::IPipe::copy(*trans, *file);
     }
 }
 
@@ -36,9 +35,7 @@ void IVoidPartition::write(std::shared_ptr<transport::ITransport> &trans, int8_t
     auto read_trans = readTransport();
     auto zlib = std::make_shared<transport::IZlibTransport>(read_trans);
     auto zlib_out = std::make_shared<transport::IZlibTransport>(trans, compression);
-    uint8_t bb[256];
-    uint32_t read;
-    while ((read = zlib->read(bb, 256)) > 0) { zlib_out->write(bb, read); }
+    transport::IPipe::copy(*zlib, *zlib_out);
     zlib_out->flush();
 }
 
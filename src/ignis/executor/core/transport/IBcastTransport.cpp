@@ -0,0 +1,92 @@
+
+#include "IBcastTransport.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+using namespace ignis::executor::core::transport;
+
+IBcastTransport::IBcastTransport(const MPI::Intracomm &group, int root, int64_t chunk)
+    : comm(group), root(root), is_root(group.Get_rank() == root),
+      chunk(std::max<int64_t>(1, std::min<int64_t>(chunk, std::numeric_limits<int>::max() - sizeof(int64_t)))),
+      started(false), ended(false), request(MPI_REQUEST_NULL), pos(0), next_length(0) {}
+
+IBcastTransport::~IBcastTransport() { wait(); }
+
+uint32_t IBcastTransport::read(uint8_t *buf, uint32_t len) {
+    if (!started || pos + sizeof(int64_t) >= ready.size()) { next(); }
+    if (ended) { return 0; }
+    uint32_t bytes = (uint32_t) std::min<size_t>(len, ready.size() - sizeof(int64_t) - pos);
+    std::memcpy(buf, &ready[pos], bytes);
+    pos += bytes;
+    return bytes;
+}
+
+void IBcastTransport::write(const uint8_t *buf, uint32_t len) {
+    while (len > 0) {
+        uint32_t bytes = (uint32_t) std::min<int64_t>(len, chunk - filling.size());
+        filling.insert(filling.end(), buf, buf + bytes);
+        buf += bytes;
+        len -= bytes;
+        if (filling.size() == chunk) { seal(); }
+    }
+}
+
+void IBcastTransport::finish() {
+    if (is_root) {
+        if (!started || !filling.empty()) { seal(); }
+        if (!ready.empty()) {
+            /*Length 0 marks the end of the stream*/
+            int64_t end = 0;
+            ready.insert(ready.end(), (uint8_t *) &end, (uint8_t *) &end + sizeof(int64_t));
+            wait();
+            flight.swap(ready);
+            MPI_Ibcast(&flight[0], (int) flight.size(), MPI_BYTE, root, comm, &request);
+        }
+        wait();
+    } else {
+        while (!ended) { next(); }
+    }
+}
+
+void IBcastTransport::seal() {
+    int64_t length = filling.size();
+    if (!started) {
+        MPI_Bcast(&length, 1, MPI_LONG, root, comm);
+        started = true;
+    } else {
+        ready.insert(ready.end(), (uint8_t *) &length, (uint8_t *) &length + sizeof(int64_t));
+        wait();
+        flight.swap(ready);
+        MPI_Ibcast(&flight[0], (int) flight.size(), MPI_BYTE, root, comm, &request);
+    }
+    ready.swap(filling);
+    filling.clear();
+}
+
+void IBcastTransport::next() {
+    if (!started) {
+        MPI_Bcast(&next_length, 1, MPI_LONG, root, comm);
+        started = true;
+        if (next_length > 0) {
+            flight.resize(next_length + sizeof(int64_t));
+            MPI_Ibcast(&flight[0], (int) flight.size(), MPI_BYTE, root, comm, &request);
+        }
+    }
+    if (next_length == 0) {
+        ended = true;
+        return;
+    }
+    wait();
+    ready.swap(flight);
+    pos = 0;
+    std::memcpy(&next_length, &ready[ready.size() - sizeof(int64_t)], sizeof(int64_t));
+    if (next_length > 0) {
+        flight.resize(next_length + sizeof(int64_t));
+        MPI_Ibcast(&flight[0], (int) flight.size(), MPI_BYTE, root, comm, &request);
+    }
+}
+
+void IBcastTransport::wait() {
+    if (request != MPI_REQUEST_NULL) { MPI_Wait(&request, MPI_STATUS_IGNORE); }
+}
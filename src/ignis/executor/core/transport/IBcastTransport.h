@@ -0,0 +1,55 @@
+
+#ifndef IGNIS_IBCASTTRANSPORT_H
+#define IGNIS_IBCASTTRANSPORT_H
+
+#include "ITransport.h"
+#include <mpi.h>
+#include <vector>
+
+namespace ignis {
+    namespace executor {
+        namespace core {
+            namespace transport {
+                /*
+                 * Streams the bytes written by the root to the other ranks of the group in chunks. Each chunk carries
+                 * the length of the next one, so a chunk is broadcast while the previous one is being consumed.
+                 */
+                class IBcastTransport : public apache::thrift::transport::TVirtualTransport<IBcastTransport> {
+                public:
+                    IBcastTransport(const MPI::Intracomm &group, int root, int64_t chunk);
+
+                    virtual ~IBcastTransport();
+
+                    uint32_t read(uint8_t *buf, uint32_t len);
+
+                    void write(const uint8_t *buf, uint32_t len);
+
+                    /*Sends or discards the remaining chunks, all ranks must call it*/
+                    void finish();
+
+                private:
+                    void seal();
+
+                    void next();
+
+                    void wait();
+
+                    MPI_Comm comm;
+                    int root;
+                    bool is_root;
+                    int64_t chunk;
+                    bool started;
+                    bool ended;
+                    std::vector<uint8_t> filling;
+                    std::vector<uint8_t> ready;
+                    std::vector<uint8_t> flight;
+                    MPI_Request request;
+                    size_t pos;
+                    int64_t next_length;
+                };
+            }// namespace transport
+        }    // namespace core
+    }        // namespace executor
+}// namespace ignis
+
+#endif
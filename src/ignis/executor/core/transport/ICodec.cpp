@@ -0,0 +1,246 @@
+#include "ICodec.h"
+#include <algorithm>
+#include <cstring>
+#include <lz4frame.h>
+#include <zstd.h>
+
+using namespace ignis::executor::core::transport;
+using apache::thrift::transport::TTransportException;
+
+namespace {
+    class ILz4Codec : public ICodec {
+    public:
+        ILz4Codec(const std::shared_ptr<ITransport> &transport, int16_t level, uint32_t buffer_size)
+            : ICodec(transport, level, buffer_size), cctx(nullptr), dctx(nullptr), started(false) {
+            std::memset(&prefs, 0, sizeof(prefs));
+            prefs.compressionLevel = level;
+            prefs.frameInfo.blockSizeID = LZ4F_max256KB;
+            /*Blocks written by different writers can be joined after a single frame header*/
+            prefs.frameInfo.blockMode = LZ4F_blockIndependent;
+            out_buffer.resize(LZ4F_compressBound(buffer_size, &prefs) + LZ4F_HEADER_SIZE_MAX);
+        }
+
+        ~ILz4Codec() override {
+            if (cctx) { LZ4F_freeCompressionContext(cctx); }
+            if (dctx) { LZ4F_freeDecompressionContext(dctx); }
+        }
+
+    protected:
+        void compress(const uint8_t *buf, size_t len) override {
+            if (!started) {
+                if (!cctx) { check(LZ4F_createCompressionContext(&cctx, LZ4F_VERSION)); }
+                size_t header = check(LZ4F_compressBegin(cctx, &out_buffer[0], out_buffer.size(), &prefs));
+                transport->write(&out_buffer[0], header);
+                started = true;
+            }
+            size_t bytes = check(LZ4F_compressUpdate(cctx, &out_buffer[0], out_buffer.size(), buf, len, nullptr));
+            if (bytes > 0) { transport->write(&out_buffer[0], bytes); }
+        }
+
+        void end() override {
+            if (!started) { return; }
+            size_t bytes = check(LZ4F_flush(cctx, &out_buffer[0], out_buffer.size(), nullptr));
+            if (bytes > 0) { transport->write(&out_buffer[0], bytes); }
+        }
+
+        size_t decompress(const uint8_t *&in, size_t &in_len, uint8_t *out, size_t out_len) override {
+            if (!dctx) { check(LZ4F_createDecompressionContext(&dctx, LZ4F_VERSION)); }
+            size_t src = in_len;
+            size_t dst = out_len;
+            check(LZ4F_decompress(dctx, out, &dst, in, &src, nullptr));
+            in += src;
+            in_len -= src;
+            return dst;
+        }
+
+    private:
+        size_t check(size_t rc) {
+            if (LZ4F_isError(rc)) {
+                throw TTransportException(TTransportException::CORRUPTED_DATA,
+                                          std::string("lz4 error: ") + LZ4F_getErrorName(rc));
+            }
+            return rc;
+        }
+
+        LZ4F_preferences_t prefs;
+        LZ4F_cctx *cctx;
+        LZ4F_dctx *dctx;
+        bool started;
+    };
+
+    class IZstdCodec : public ICodec {
+    public:
+        IZstdCodec(const std::shared_ptr<ITransport> &transport, int16_t level, bool long_range,
+                   uint32_t buffer_size)
+            : ICodec(transport, level, buffer_size), long_range(long_range), cctx(nullptr), dctx(nullptr),
+              started(false) {}
+
+        ~IZstdCodec() override {
+            if (cctx) { ZSTD_freeCCtx(cctx); }
+            if (dctx) { ZSTD_freeDCtx(dctx); }
+        }
+
+    protected:
+        void compress(const uint8_t *buf, size_t len) override {
+            if (!cctx) {
+                cctx = ZSTD_createCCtx();
+                out_buffer.resize(ZSTD_CStreamOutSize());
+                check(ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, comp_level));
+                if (long_range) { check(ZSTD_CCtx_setParameter(cctx, ZSTD_c_enableLongDistanceMatching, 1)); }
+                /*Libraries built without multithreading reject workers, compression is still valid*/
+                if (threads > 0) { ZSTD_CCtx_setParameter(cctx, ZSTD_c_nbWorkers, threads); }
+            }
+            started = true;
+            ZSTD_inBuffer input = {buf, len, 0};
+            while (input.pos < input.size) {
+                ZSTD_outBuffer output = {&out_buffer[0], out_buffer.size(), 0};
+                check(ZSTD_compressStream2(cctx, &output, &input, ZSTD_e_continue));
+                if (output.pos > 0) { transport->write(&out_buffer[0], output.pos); }
+            }
+        }
+
+        void end() override {
+            if (!started) { return; }
+            ZSTD_inBuffer input = {nullptr, 0, 0};
+            size_t remaining;
+            do {
+                ZSTD_outBuffer output = {&out_buffer[0], out_buffer.size(), 0};
+                remaining = check(ZSTD_compressStream2(cctx, &output, &input, ZSTD_e_end));
+                if (output.pos > 0) { transport->write(&out_buffer[0], output.pos); }
+            } while (remaining != 0);
+            started = false;
+        }
+
+        size_t decompress(const uint8_t *&in, size_t &in_len, uint8_t *out, size_t out_len) override {
+            if (!dctx) { dctx = ZSTD_createDCtx(); }
+            ZSTD_inBuffer input = {in, in_len, 0};
+            ZSTD_outBuffer output = {out, out_len, 0};
+            check(ZSTD_decompressStream(dctx, &output, &input));
+            in += input.pos;
+            in_len -= input.pos;
+            return output.pos;
+        }
+
+    private:
+        size_t check(size_t rc) {
+            if (ZSTD_isError(rc)) {
+                throw TTransportException(TTransportException::CORRUPTED_DATA,
+                                          std::string("zstd error: ") + ZSTD_getErrorName(rc));
+            }
+            return rc;
+        }
+
+        bool long_range;
+        ZSTD_CCtx *cctx;
+        ZSTD_DCtx *dctx;
+        bool started;
+    };
+}// namespace
+
+const int16_t ICodec::ZLIB;
+const int16_t ICodec::LZ4;
+const int16_t ICodec::ZSTD;
+const int16_t ICodec::ZSTD_LONG;
+int ICodec::threads = 0;
+
+int16_t ICodec::codec(int16_t compression) { return compression > 0 ? (compression >> 5) & 3 : ZLIB; }
+
+int16_t ICodec::level(int16_t compression) { return compression > 0 ? compression & 31 : compression; }
+
+int16_t ICodec::compression(int16_t codec, int16_t level) { return level > 0 ? (codec << 5) | level : 0; }
+
+std::shared_ptr<ICodec> ICodec::create(const std::shared_ptr<ITransport> &transport, int16_t compression,
+                                       uint32_t buffer_size) {
+    switch (codec(compression)) {
+        case LZ4:
+            return std::make_shared<ILz4Codec>(transport, level(compression), buffer_size);
+        case ZSTD:
+            return std::make_shared<IZstdCodec>(transport, level(compression), false, buffer_size);
+        case ZSTD_LONG:
+            return std::make_shared<IZstdCodec>(transport, level(compression), true, buffer_size);
+        default:
+            return nullptr;
+    }
+}
+
+void ICodec::setThreads(int threads) { ICodec::threads = threads; }
+
+ICodec::ICodec(const std::shared_ptr<ITransport> &transport, int16_t level, uint32_t buffer_size)
+    : transport(transport), comp_level(level), buffer_size(buffer_size), rpos(0), rlen(0), cpos(0), clen(0), wpos(0) {}
+
+ICodec::~ICodec() {}
+
+uint32_t ICodec::read(uint8_t *buf, uint32_t len) {
+    uint32_t done = 0;
+    while (done < len) {
+        if (rpos == rlen && !fill()) { break; }
+        size_t n = std::min<size_t>(len - done, rlen - rpos);
+        std::memcpy(buf + done, &rbuf[rpos], n);
+        rpos += n;
+        done += n;
+    }
+    return done;
+}
+
+const uint8_t *ICodec::borrow(uint8_t *buf, uint32_t *len) {
+    if (rlen - rpos >= *len) {
+        *len = rlen - rpos;
+        return rbuf.data() + rpos;
+    }
+    return nullptr;
+}
+
+void ICodec::consume(uint32_t len) {
+    if (rlen - rpos < len) {
+        throw TTransportException(TTransportException::BAD_ARGS, "consume did not follow a borrow.");
+    }
+    rpos += len;
+}
+
+bool ICodec::peek() { return rpos < rlen || cpos < clen || transport->peek(); }
+
+bool ICodec::isOpen() { return rpos < rlen || cpos < clen || transport->isOpen(); }
+
+void ICodec::write(const uint8_t *buf, uint32_t len) {
+    if (wbuf.empty()) { wbuf.resize(buffer_size); }
+    while (len > 0) {
+        size_t n = std::min<size_t>(len, wbuf.size() - wpos);
+        std::memcpy(&wbuf[wpos], buf, n);
+        wpos += n;
+        buf += n;
+        len -= n;
+        if (wpos == wbuf.size()) {
+            compress(&wbuf[0], wpos);
+            wpos = 0;
+        }
+    }
+}
+
+void ICodec::flush() {
+    if (wpos > 0) {
+        compress(&wbuf[0], wpos);
+        wpos = 0;
+    }
+    end();
+    transport->flush();
+}
+
+bool ICodec::fill() {
+    if (rbuf.empty()) {
+        rbuf.resize(buffer_size);
+        cbuf.resize(buffer_size);
+    }
+    rpos = rlen = 0;
+    while (rlen == 0) {
+        if (cpos == clen) {
+            cpos = 0;
+            clen = transport->read(&cbuf[0], cbuf.size());
+            if (clen == 0) { return false; }
+        }
+        const uint8_t *in = &cbuf[cpos];
+        size_t in_len = clen - cpos;
+        rlen = decompress(in, in_len, &rbuf[0], rbuf.size());
+        cpos = clen - in_len;
+    }
+    return true;
+}
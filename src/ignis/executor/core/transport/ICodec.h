@@ -0,0 +1,82 @@
+#ifndef IGNIS_ICODEC_H
+#define IGNIS_ICODEC_H
+
+#include "ITransport.h"
+#include <vector>
+
+namespace ignis {
+    namespace executor {
+        namespace core {
+            namespace transport {
+                /*
+                 * Streaming compressor used by IZlibTransport when the compression byte selects a codec other than
+                 * zlib. The byte keeps the level in the five low bits and the codec in the next two, so values 0-9
+                 * are still zlib levels. Like a zlib full flush, the output of a flush can be decoded on its own
+                 * after the stream header, raw partitions join the output of different writers.
+                 */
+                class ICodec {
+                public:
+                    static const int16_t ZLIB = 0;
+                    static const int16_t LZ4 = 1;
+                    static const int16_t ZSTD = 2;
+                    static const int16_t ZSTD_LONG = 3;
+
+                    static int16_t codec(int16_t compression);
+
+                    static int16_t level(int16_t compression);
+
+                    static int16_t compression(int16_t codec, int16_t level);
+
+                    /*Returns nullptr for zlib*/
+                    static std::shared_ptr<ICodec> create(const std::shared_ptr<ITransport> &transport,
+                                                          int16_t compression, uint32_t buffer_size = 256 * 1024);
+
+                    /*Zstd worker threads, 0 compress in the calling thread*/
+                    static void setThreads(int threads);
+
+                    virtual ~ICodec();
+
+                    uint32_t read(uint8_t *buf, uint32_t len);
+
+                    const uint8_t *borrow(uint8_t *buf, uint32_t *len);
+
+                    void consume(uint32_t len);
+
+                    bool peek();
+
+                    bool isOpen();
+
+                    void write(const uint8_t *buf, uint32_t len);
+
+                    void flush();
+
+                protected:
+                    ICodec(const std::shared_ptr<ITransport> &transport, int16_t level, uint32_t buffer_size);
+
+                    /*Compresses len bytes and writes the output to the transport, a frame is started if needed*/
+                    virtual void compress(const uint8_t *buf, size_t len) = 0;
+
+                    /*Writes the pending output, the next block must not depend on the previous ones*/
+                    virtual void end() = 0;
+
+                    /*Advances in and in_len over the consumed input and returns the decompressed bytes*/
+                    virtual size_t decompress(const uint8_t *&in, size_t &in_len, uint8_t *out, size_t out_len) = 0;
+
+                    static int threads;
+                    std::shared_ptr<ITransport> transport;
+                    int16_t comp_level;
+                    std::vector<uint8_t> out_buffer;
+
+                private:
+                    bool fill();
+
+                    uint32_t buffer_size;
+                    std::vector<uint8_t> rbuf, cbuf, wbuf;
+                    size_t rpos, rlen, cpos, clen, wpos;
+                };
+            }// namespace transport
+        }    // namespace core
+    }        // namespace executor
+}// namespace ignis
+
+#endif
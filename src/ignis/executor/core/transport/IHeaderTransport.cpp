@@ -23,8 +23,17 @@ uint32_t IHeaderTransport::read(uint8_t *buf, uint32_t len) {
 void IHeaderTransport::write(const uint8_t *buf, uint32_t len) { trans->write_virt(buf, len); }
 
 const uint8_t *IHeaderTransport::borrow(uint8_t *buf, uint32_t *len) {
-    if (header.empty()) { return nullptr; }
-    return trans->borrow_virt(buf, len);
+    if (header.empty()) { return trans->borrow_virt(buf, len); }
+    if (header.size() - pos < *len) { return nullptr; }
+    *len = header.size() - pos;
+    return reinterpret_cast<const uint8_t *>(header.c_str()) + pos;
 }
 
-void IHeaderTransport::consume(uint32_t len) { trans->consume_virt(len); }
+void IHeaderTransport::consume(uint32_t len) {
+    if (header.empty()) {
+        trans->consume_virt(len);
+        return;
+    }
+    pos += len;
+    if (pos == header.size()) { header.clear(); }
+}
@@ -0,0 +1,33 @@
+#include "IMappedBuffer.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace ignis::executor::core::transport;
+
+size_t IMappedBuffer::min_size = 0;
+
+std::shared_ptr<IMappedBuffer> IMappedBuffer::map(const std::string &path, const std::shared_ptr<void> &owner) {
+    if (min_size == 0) { return nullptr; }
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) { return nullptr; }
+    struct stat64 st;
+    void *data = MAP_FAILED;
+    if (::fstat64(fd, &st) == 0 && st.st_size > 0 && (size_t) st.st_size >= min_size) {
+        data = ::mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    /*The mapping keeps its own reference to the file*/
+    ::close(fd);
+    if (data == MAP_FAILED) { return nullptr; }
+    ::madvise(data, st.st_size, MADV_SEQUENTIAL);
+    ::madvise(data, st.st_size, MADV_WILLNEED);
+    return std::shared_ptr<IMappedBuffer>(new IMappedBuffer(reinterpret_cast<uint8_t *>(data), st.st_size, owner));
+}
+
+void IMappedBuffer::setMinSize(size_t size) { min_size = size; }
+
+IMappedBuffer::IMappedBuffer(uint8_t *data, size_t size, const std::shared_ptr<void> &owner)
+    : IMemoryBuffer(data, size, OBSERVE), data(data), size(size), owner(owner) {}
+
+IMappedBuffer::~IMappedBuffer() { ::munmap(data, size); }
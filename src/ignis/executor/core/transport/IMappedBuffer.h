@@ -0,0 +1,36 @@
+#ifndef IGNIS_IMAPPEDBUFFER_H
+#define IGNIS_IMAPPEDBUFFER_H
+
+#include "IMemoryBuffer.h"
+
+namespace ignis {
+    namespace executor {
+        namespace core {
+            namespace transport {
+                /*Read only buffer over a file mapped in memory, readers borrow the data from the page cache*/
+                class IMappedBuffer : public IMemoryBuffer {
+                public:
+                    /*Returns nullptr if mapping is disabled, the file is smaller than the minimum size or the file
+                     * can not be mapped. The buffer keeps a copy of owner while it is alive*/
+                    static std::shared_ptr<IMappedBuffer> map(const std::string &path,
+                                                              const std::shared_ptr<void> &owner = nullptr);
+
+                    /*Files from size bytes are mapped, 0 disables mapping*/
+                    static void setMinSize(size_t size);
+
+                    virtual ~IMappedBuffer();
+
+                private:
+                    IMappedBuffer(uint8_t *data, size_t size, const std::shared_ptr<void> &owner);
+
+                    static size_t min_size;
+                    uint8_t *data;
+                    size_t size;
+                    std::shared_ptr<void> owner;
+                };
+            }// namespace transport
+        }    // namespace core
+    }        // namespace executor
+}// namespace ignis
+
+#endif
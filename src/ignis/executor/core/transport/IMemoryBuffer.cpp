@@ -1,6 +1,7 @@
 
 #include "IMemoryBuffer.h"
 #include <algorithm>
+#include <limits>
 
 using namespace ignis::executor::core::transport;
 using namespace apache::thrift::transport;
@@ -151,10 +152,7 @@ uint32_t IMemoryBuffer::readEnd() {
     return bytes;
 }
 
-uint32_t IMemoryBuffer::writeEnd() {
-    // This cast should be safe, because buffer_'s size is a uint32_t
-    return static_cast<uint32_t>(wBase_ - buffer_);
-}
+size_t IMemoryBuffer::writeEnd() { return static_cast<size_t>(wBase_ - buffer_); }
 
 size_t IMemoryBuffer::available_read() const {
     // Remember, wBase_ is the real rBound_.
@@ -163,12 +161,12 @@ size_t IMemoryBuffer::available_read() const {
 
 size_t IMemoryBuffer::available_write() const { return static_cast<size_t>(wBound_ - wBase_); }
 
-uint8_t *IMemoryBuffer::getWritePtr(uint32_t len) {
+uint8_t *IMemoryBuffer::getWritePtr(size_t len) {
     ensureCanWrite(len);
     return wBase_;
 }
 
-void IMemoryBuffer::wroteBytes(uint32_t len) {
+void IMemoryBuffer::wroteBytes(size_t len) {
     size_t avail = available_write();
     if (len > avail) { throw TTransportException("Client wrote more bytes than size of buffer."); }
     wBase_ += len;
@@ -260,7 +258,8 @@ const uint8_t *IMemoryBuffer::borrowSlow(uint8_t *buf, uint32_t *len) {
     (void) buf;
     rBound_ = wBase_;
     if (available_read() >= *len) {
-        *len = available_read();
+        /*Mapped files can be larger than a borrow length*/
+        *len = (uint32_t) std::min<size_t>(available_read(), std::numeric_limits<uint32_t>::max());
         return rBase_;
     }
     return nullptr;
@@ -106,7 +106,7 @@ namespace ignis {
                     uint32_t readEnd();
 
                     // Return number of bytes written
-                    uint32_t writeEnd();
+                    size_t writeEnd();
 
                     size_t available_read() const;
 
@@ -119,13 +119,13 @@ namespace ignis {
                      * passing to read(), recv(), or similar. You must call wroteBytes() as soon
                      * as data is written or the buffer will not be aware that data has changed.
                      */
-                    uint8_t *getWritePtr(uint32_t len);
+                    uint8_t *getWritePtr(size_t len);
 
                     /*
                      * Informs the buffer that the client has written 'len' bytes into storage_old
                      * that had been provided by getWritePtr().
                      */
-                    void wroteBytes(uint32_t len);
+                    void wroteBytes(size_t len);
 
                     /*
                      * TVirtualTransport provides a default implementation of readAll().
@@ -0,0 +1,73 @@
+#include "IPipe.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/sendfile.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace ignis::executor::core::transport;
+using apache::thrift::transport::TTransportException;
+
+size_t IPipe::buffer_size = 1024 * 1024;
+
+void IPipe::setBufferSize(size_t size) { buffer_size = std::max<size_t>(size, 4096); }
+
+size_t IPipe::bufferSize() { return buffer_size; }
+
+std::vector<uint8_t> &IPipe::buffer() {
+    static thread_local std::vector<uint8_t> buf;
+    if (buf.size() != buffer_size) {
+        buf.resize(buffer_size);
+        buf.shrink_to_fit();
+    }
+    return buf;
+}
+
+void IPipe::copy(ITransport &in, ITransport &out) {
+    auto &buf = buffer();
+    uint32_t size = (uint32_t) std::min<size_t>(buf.size(), UINT32_MAX);
+    while (true) {
+        uint32_t len = 1;
+        const uint8_t *ptr = in.borrow(nullptr, &len);
+        if (ptr != nullptr) {
+            out.write(ptr, len);
+            in.consume(len);
+            continue;
+        }
+        uint32_t read = in.read(&buf[0], size);
+        if (read == 0) { break; }
+        out.write(&buf[0], read);
+    }
+}
+
+void IPipe::copyFile(int in, int out) {
+    struct stat64 st;
+    if (::fstat64(in, &st) != 0) {
+        throw TTransportException(TTransportException::UNKNOWN, "fstat failed", errno);
+    }
+    /*Kernel copies use the file offset, they are rejected on append mode*/
+    int flags = ::fcntl(out, F_GETFL);
+    if (flags & O_APPEND) { ::fcntl(out, F_SETFL, flags & ~O_APPEND); }
+    ::lseek64(out, 0, SEEK_END);
+    off64_t pos = 0;
+    off64_t len = st.st_size;
+    bool kernel = true;
+    while (kernel && pos < len) {
+        ssize_t bytes = ::copy_file_range(in, &pos, out, nullptr, len - pos, 0);
+        if (bytes <= 0) { bytes = ::sendfile64(out, in, &pos, len - pos); }
+        kernel = bytes > 0;
+    }
+    auto &buf = buffer();
+    while (pos < len) {
+        ssize_t bytes = ::pread64(in, &buf[0], std::min<off64_t>(buf.size(), len - pos), pos);
+        if (bytes <= 0 || ::write(out, &buf[0], bytes) != bytes) {
+            if (flags & O_APPEND) { ::fcntl(out, F_SETFL, flags); }
+            throw TTransportException(TTransportException::UNKNOWN, "file copy failed", errno);
+        }
+        pos += bytes;
+    }
+    if (flags & O_APPEND) { ::fcntl(out, F_SETFL, flags); }
+}
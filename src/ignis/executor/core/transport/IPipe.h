@@ -0,0 +1,35 @@
+#ifndef IGNIS_IPIPE_H
+#define IGNIS_IPIPE_H
+
+#include "ITransport.h"
+#include <vector>
+
+namespace ignis {
+    namespace executor {
+        namespace core {
+            namespace transport {
+                /*Moves bytes between transports and files using a buffer reused by each thread*/
+                class IPipe {
+                public:
+                    static void setBufferSize(size_t size);
+
+                    static size_t bufferSize();
+
+                    /*Thread buffer of bufferSize bytes, valid until the next call in the same thread*/
+                    static std::vector<uint8_t> &buffer();
+
+                    /*Copies until the end of in, borrowed bytes are written without an intermediate copy*/
+                    static void copy(ITransport &in, ITransport &out);
+
+                    /*Appends in to out from the start, the kernel copies the data when both files allow it*/
+                    static void copyFile(int in, int out);
+
+                private:
+                    static size_t buffer_size;
+                };
+            }// namespace transport
+        }    // namespace core
+    }        // namespace executor
+}// namespace ignis
+
+#endif
@@ -0,0 +1,174 @@
+#include "IWriteBehind.h"
+#include "ignis/executor/core/exception/IInvalidArgument.h"
+#include "ignis/executor/core/exception/ILogicError.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace ignis::executor::core::transport;
+using namespace ignis::executor::core;
+
+IWriteBehind::IWriteBehind(size_t block_size, size_t max_blocks, int writers)
+    : block_size(block_size), max_blocks(std::max<size_t>(max_blocks, 1)), used(0), pending(0), stop(false) {
+    for (int i = 0; i < writers; i++) { threads.emplace_back(&IWriteBehind::run, this); }
+}
+
+std::shared_ptr<IWriteBehindFile> IWriteBehind::open(const std::string &path) {
+    return std::make_shared<IWriteBehindFile>(*this, path);
+}
+
+void IWriteBehind::wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    done_cv.wait(lock, [this] { return pending == 0; });
+    if (!error.empty()) {
+        std::string msg;
+        msg.swap(error);
+        throw exception::ILogicError(msg);
+    }
+}
+
+IWriteBehind::~IWriteBehind() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+    job_cv.notify_all();
+    for (auto &thread : threads) { thread.join(); }
+}
+
+std::vector<char> IWriteBehind::take() {
+    std::unique_lock<std::mutex> lock(mutex);
+    free_cv.wait(lock, [this] { return used < max_blocks; });
+    used++;
+    if (pool.empty()) {
+        lock.unlock();
+        return std::vector<char>(block_size);
+    }
+    auto block = std::move(pool.back());
+    pool.pop_back();
+    return block;
+}
+
+void IWriteBehind::submit(Job &&job) {
+    if (threads.empty()) {
+        write(job);
+        release(std::move(job.block));
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending++;
+        jobs.push_back(std::move(job));
+    }
+    job_cv.notify_one();
+}
+
+void IWriteBehind::release(std::vector<char> &&block) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        used--;
+        block.resize(block_size);
+        pool.push_back(std::move(block));
+    }
+    free_cv.notify_one();
+}
+
+void IWriteBehind::write(Job &job) {
+    const char *data = job.block.data();
+    size_t size = job.block.size();
+    int64_t offset = job.offset;
+    while (size > 0) {
+        auto bytes = ::pwrite64(*job.fd, data, size, offset);
+        if (bytes < 0 && errno == EINTR) { continue; }
+        if (bytes <= 0) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (error.empty()) { error = std::string("write behind: ") + std::strerror(errno); }
+            return;
+        }
+        data += bytes;
+        size -= bytes;
+        offset += bytes;
+    }
+}
+
+void IWriteBehind::run() {
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            job_cv.wait(lock, [this] { return stop || !jobs.empty(); });
+            if (jobs.empty()) { return; }
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+        write(job);
+        /*The last block of a file closes the descriptor*/
+        job.fd.reset();
+        release(std::move(job.block));
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending--;
+        }
+        done_cv.notify_all();
+    }
+}
+
+IWriteBehindFile::IWriteBehindFile(IWriteBehind &queue, const std::string &path)
+    : queue(queue), path(path), offset(0) {
+    int file = ::open(path.c_str(), O_WRONLY | O_TRUNC);
+    if (file < 0) { throw exception::IInvalidArgument(path + " cannot be opened"); }
+    fd = std::shared_ptr<int>(new int(file), [](int *fd) {
+        ::close(*fd);
+        delete fd;
+    });
+}
+
+void IWriteBehindFile::write(const uint8_t *buf, uint32_t len) {
+    if (sputn(reinterpret_cast<const char *>(buf), len) != len) {
+        throw exception::ILogicError("write behind: " + path + " is closed");
+    }
+}
+
+uint32_t IWriteBehindFile::read(uint8_t *buf, uint32_t len) {
+    throw exception::ILogicError("write behind: " + path + " is write only");
+}
+
+void IWriteBehindFile::close() {
+    if (!fd) { return; }
+    submit();
+    fd.reset();
+}
+
+IWriteBehindFile::~IWriteBehindFile() {
+    if (!block.empty()) { queue.release(std::move(block)); }
+}
+
+IWriteBehindFile::int_type IWriteBehindFile::overflow(int_type c) {
+    if (!fd) { return traits_type::eof(); }
+    if (pptr() == epptr()) {
+        if (!block.empty()) { submit(); }
+        block = queue.take();
+        setp(block.data(), block.data() + block.size());
+    }
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(c);
+        pbump(1);
+    }
+    return traits_type::not_eof(c);
+}
+
+void IWriteBehindFile::submit() {
+    if (block.empty()) { return; }
+    size_t size = pptr() - pbase();
+    block.resize(size);
+    IWriteBehind::Job job;
+    job.fd = fd;
+    job.offset = offset;
+    job.block = std::move(block);
+    offset += size;
+    block.clear();
+    setp(nullptr, nullptr);
+    queue.submit(std::move(job));
+}
@@ -0,0 +1,104 @@
+#ifndef IGNIS_IWRITEBEHIND_H
+#define IGNIS_IWRITEBEHIND_H
+
+#include "ITransport.h"
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ignis {
+    namespace executor {
+        namespace core {
+            namespace transport {
+                class IWriteBehindFile;
+
+                /*
+                 * Writes files in the background. Files are filled in blocks and every full block is queued to the
+                 * writer threads, which write it at its offset with pwrite. At most max_blocks blocks are being filled
+                 * or queued, a file waits for a free block when the writers fall behind. Without writer threads the
+                 * blocks are written by the thread that fills them.
+                 */
+                class IWriteBehind {
+                public:
+                    IWriteBehind(size_t block_size, size_t max_blocks, int writers);
+
+                    /*The file must exist, it is written from the start*/
+                    std::shared_ptr<IWriteBehindFile> open(const std::string &path);
+
+                    /*Completion barrier, returns when every queued block is written to the OS and throws the first
+                     * error. Files are not synced to disk*/
+                    void wait();
+
+                    virtual ~IWriteBehind();
+
+                private:
+                    friend class IWriteBehindFile;
+
+                    struct Job {
+                        std::shared_ptr<int> fd;
+                        int64_t offset;
+                        std::vector<char> block;
+                    };
+
+                    std::vector<char> take();
+
+                    void submit(Job &&job);
+
+                    void release(std::vector<char> &&block);
+
+                    void write(Job &job);
+
+                    void run();
+
+                    size_t block_size;
+                    size_t max_blocks;
+                    size_t used;
+                    size_t pending;
+                    bool stop;
+                    std::string error;
+                    std::vector<std::vector<char>> pool;
+                    std::deque<Job> jobs;
+                    std::vector<std::thread> threads;
+                    std::mutex mutex;
+                    std::condition_variable job_cv, free_cv, done_cv;
+                };
+
+                /*File of a write behind queue, usable as a transport or as the buffer of a std::ostream*/
+                class IWriteBehindFile
+                    : public apache::thrift::transport::TVirtualTransport<IWriteBehindFile, ITransport>,
+                      public std::streambuf {
+                public:
+                    IWriteBehindFile(IWriteBehind &queue, const std::string &path);
+
+                    void write(const uint8_t *buf, uint32_t len);
+
+                    uint32_t read(uint8_t *buf, uint32_t len);
+
+                    /*Queues the last block, the data is written to the OS after IWriteBehind::wait*/
+                    void close() override;
+
+                    virtual ~IWriteBehindFile();
+
+                protected:
+                    int_type overflow(int_type c) override;
+
+                private:
+                    void submit();
+
+                    IWriteBehind &queue;
+                    std::string path;
+                    std::shared_ptr<int> fd;
+                    std::vector<char> block;
+                    int64_t offset;
+                };
+            }// namespace transport
+        }    // namespace core
+    }        // namespace executor
+}// namespace ignis
+
+#endif
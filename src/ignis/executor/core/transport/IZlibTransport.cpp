@@ -5,8 +5,9 @@ using namespace apache::thrift::transport;
 
 IZlibTransport::IZlibTransport(const std::shared_ptr<TTransport> &transport, int16_t comp_level, int urbuf_size,
                                int crbuf_size, int uwbuf_size, int cwbuf_size)
-    : IVirtualTransport(transport, urbuf_size, crbuf_size, uwbuf_size, cwbuf_size, comp_level),
-      in_compression(comp_level), winit(false), rinit(false) {}
+    : IVirtualTransport(transport, urbuf_size, crbuf_size, uwbuf_size, cwbuf_size,
+                        ICodec::codec(comp_level) == ICodec::ZLIB ? comp_level : 0),
+      in_compression(comp_level), out_compression(comp_level), winit(false), rinit(false) {}
 
 
 void IZlibTransport::reset() {
@@ -14,7 +15,9 @@ void IZlibTransport::reset() {
     uwpos_ = 0;
     rinit = false;
     winit = false;
-    in_compression = comp_level_;
+    in_compression = out_compression;
+    rcodec.reset();
+    wcodec.reset();
     input_ended_ = false;
     output_finished_ = false;
     inflateEnd(rstream_);
@@ -35,7 +38,9 @@ int16_t IZlibTransport::getInCompression() {
 }
 
 bool IZlibTransport::isOpen() const {
-    if (in_compression > 0) {
+    if (rcodec) {
+        return rcodec->isOpen();
+    } else if (in_compression > 0) {
         return TZlibTransport::isOpen();
     } else {
         return transport_->isOpen();
@@ -43,7 +48,9 @@ bool IZlibTransport::isOpen() const {
 }
 
 bool IZlibTransport::peek() {
-    if (in_compression > 0) {
+    if (rcodec) {
+        return rcodec->peek();
+    } else if (in_compression > 0) {
         return TZlibTransport::peek();
     } else {
         return transport_->peek();
@@ -52,11 +59,13 @@ bool IZlibTransport::peek() {
 
 uint32_t IZlibTransport::read(uint8_t *buf, uint32_t len) {
     if (!rinit) {
-        uint8_t v = comp_level_;
+        uint8_t v = out_compression;
         rinit = transport_->readAll(&v, 1) > 0;
-        in_compression = v;
+        setInCompression(v);
     }
-    if (in_compression > 0) {
+    if (rcodec) {
+        return rcodec->read(buf, len);
+    } else if (in_compression > 0) {
         return TZlibTransport::read(buf, len);
     } else {
         return transport_->read(buf, len);
@@ -66,10 +75,13 @@ uint32_t IZlibTransport::read(uint8_t *buf, uint32_t len) {
 void IZlibTransport::write(const uint8_t *buf, uint32_t len) {
     if (!winit) {
         winit = true;
-        uint8_t v = (uint8_t) comp_level_;
+        uint8_t v = (uint8_t) out_compression;
         transport_->write(&v, 1);
+        wcodec = ICodec::create(transport_, out_compression);
     }
-    if (comp_level_ > 0) {
+    if (wcodec) {
+        wcodec->write(buf, len);
+    } else if (comp_level_ > 0) {
         TZlibTransport::write(buf, len);
     } else {
         transport_->write(buf, len);
@@ -77,7 +89,11 @@ void IZlibTransport::write(const uint8_t *buf, uint32_t len) {
 }
 
 void IZlibTransport::finish() {
-    if (comp_level_ > 0) { TZlibTransport::finish(); }
+    if (wcodec) {
+        wcodec->flush();
+    } else if (comp_level_ > 0) {
+        TZlibTransport::finish();
+    }
 }
 
 const uint8_t *IZlibTransport::borrow(uint8_t *buf, uint32_t *len) {
@@ -86,13 +102,15 @@ const uint8_t *IZlibTransport::borrow(uint8_t *buf, uint32_t *len) {
         const uint8_t *cbuf = transport_->borrow(buf, &clen);
         if (clen >= 1 && cbuf != nullptr) {
             rinit = true;
-            in_compression = cbuf[0];
+            setInCompression(cbuf[0]);
             transport_->consume(1);
-            return transport_->borrow(buf, len);
+            return rcodec ? rcodec->borrow(buf, len) : transport_->borrow(buf, len);
         }
         return cbuf;
     }
-    if (in_compression > 0) {
+    if (rcodec) {
+        return rcodec->borrow(buf, len);
+    } else if (in_compression > 0) {
         return TZlibTransport::borrow(buf, len);
     } else {
         return transport_->borrow(buf, len);
@@ -100,7 +118,9 @@ const uint8_t *IZlibTransport::borrow(uint8_t *buf, uint32_t *len) {
 }
 
 void IZlibTransport::consume(uint32_t len) {
-    if (in_compression > 0) {
+    if (rcodec) {
+        rcodec->consume(len);
+    } else if (in_compression > 0) {
         TZlibTransport::consume(len);
     } else {
         transport_->consume(len);
@@ -108,7 +128,12 @@ void IZlibTransport::consume(uint32_t len) {
 }
 
 void IZlibTransport::verifyChecksum() {
-    if (in_compression > 0) { TZlibTransport::verifyChecksum(); }
+    if (!rcodec && in_compression > 0) { TZlibTransport::verifyChecksum(); }
+}
+
+void IZlibTransport::setInCompression(uint8_t compression) {
+    in_compression = compression;
+    rcodec = ICodec::create(transport_, in_compression);
 }
 
 
@@ -119,10 +144,14 @@ void IZlibTransport::flush() {
     if (!winit) {
         uint8_t tmp;
         write(&tmp, 0);
-    } else if (comp_level_ == 0) {
+    } else if (comp_level_ == 0 && !wcodec) {
         transport_->flush();
         return;
     }
+    if (wcodec) {
+        wcodec->flush();
+        return;
+    }
     ///////////
 
     if (output_finished_) { throw TTransportException(TTransportException::BAD_ARGS, "flush() called after finish()"); }
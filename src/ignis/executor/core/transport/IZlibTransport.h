@@ -2,6 +2,7 @@
 #ifndef IGNIS_IZLIBTRANSPORT_H
 #define IGNIS_IZLIBTRANSPORT_H
 
+#include "ICodec.h"
 #include "ITransport.h"
 #include <thrift/transport/TZlibTransport.h>
 
@@ -9,6 +10,7 @@ namespace ignis {
     namespace executor {
         namespace core {
             namespace transport {
+                /*The compression byte written before the data can select other codecs, see ICodec*/
                 class IZlibTransport
                     : public IVirtualTransport<IZlibTransport, apache::thrift::transport::TZlibTransport> {
                 public:
@@ -42,10 +44,14 @@ namespace ignis {
                     void verifyChecksum();
 
                 private:
-                    int16_t in_compression;
+                    int16_t in_compression, out_compression;
 
                     bool winit, rinit;
 
+                    std::shared_ptr<ICodec> rcodec, wcodec;
+
+                    void setInCompression(uint8_t compression);
+
                     void flushToZlib(const uint8_t *buf, int len, int flush);
 
                     void checkZlibRv(int status, const char *message);
@@ -43,6 +43,16 @@ struct ignis::executor::core::IElements<std::string> {
     }
 };
 
+template<>
+struct ignis::executor::core::IElements<double> {
+    static api::IVector<double> create(int n, int seed) {
+        std::srand(seed);
+        api::IVector<double> v;
+        for (int i = 0; i < n; i++) { v.push_back((double) std::rand() / RAND_MAX); }
+        return v;
+    }
+};
+
 template<>
 struct ignis::executor::core::IElements<uint8_t> {
     static api::IVector<uint8_t> create(int n, int seed) {
@@ -0,0 +1,120 @@
+
+#include "IHashTableTest.h"
+#include <set>
+#include <string>
+
+using namespace ignis::executor::core;
+
+namespace {
+    /*Only 4 distinct hashes, every key collides with a quarter of the table*/
+    struct ICollisionHash {
+        size_t operator()(int key) const { return key % 4; }
+    };
+}// namespace
+
+void IHashTableTest::insertFindTest() {
+    IHashSet<int> set;
+    CPPUNIT_ASSERT(set.find(1) == set.end());
+    for (int i = 0; i < 1000; i++) { CPPUNIT_ASSERT(set.insert(i * 7).second); }
+    CPPUNIT_ASSERT_EQUAL((size_t) 1000, set.size());
+    for (int i = 0; i < 1000; i++) {
+        auto it = set.find(i * 7);
+        CPPUNIT_ASSERT(it != set.end());
+        CPPUNIT_ASSERT_EQUAL(i * 7, *it);
+        CPPUNIT_ASSERT(set.find(i * 7 + 1) == set.end());
+    }
+    auto result = set.insert(14);
+    CPPUNIT_ASSERT(!result.second);
+    CPPUNIT_ASSERT_EQUAL(14, *result.first);
+    CPPUNIT_ASSERT_EQUAL((size_t) 1000, set.size());
+}
+
+void IHashTableTest::growthTest() {
+    IHashSet<int> set;
+    size_t capacity = set.capacity();
+    int grows = 0;
+    for (int i = 0; i < 10000; i++) {
+        set.insert(i);
+        /*Max load 7/8*/
+        CPPUNIT_ASSERT(set.size() * 8 <= set.capacity() * 7);
+        if (set.capacity() != capacity) {
+            capacity = set.capacity();
+            grows++;
+        }
+    }
+    CPPUNIT_ASSERT(grows > 5);
+    for (int i = 0; i < 10000; i++) { CPPUNIT_ASSERT(set.find(i) != set.end()); }
+
+    IHashSet<int> reserved;
+    reserved.reserve(10000);
+    capacity = reserved.capacity();
+    for (int i = 0; i < 10000; i++) { reserved.insert(i); }
+    CPPUNIT_ASSERT_EQUAL(capacity, reserved.capacity());
+
+    set.clear();
+    CPPUNIT_ASSERT(set.empty());
+    CPPUNIT_ASSERT(set.begin() == set.end());
+    CPPUNIT_ASSERT(set.find(5) == set.end());
+}
+
+void IHashTableTest::eraseTest() {
+    IHashSet<std::string> set;
+    for (int i = 0; i < 2000; i++) { set.insert(std::to_string(i)); }
+    for (int i = 0; i < 2000; i += 2) { CPPUNIT_ASSERT_EQUAL((size_t) 1, set.erase(std::to_string(i))); }
+    CPPUNIT_ASSERT_EQUAL((size_t) 0, set.erase("0"));
+    CPPUNIT_ASSERT_EQUAL((size_t) 1000, set.size());
+    for (int i = 0; i < 2000; i++) { CPPUNIT_ASSERT_EQUAL(i % 2 == 1, set.find(std::to_string(i)) != set.end()); }
+    set.erase(set.find("1"));
+    CPPUNIT_ASSERT(set.find("1") == set.end());
+    for (int i = 0; i < 2000; i += 2) { CPPUNIT_ASSERT(set.insert(std::to_string(i)).second); }
+    CPPUNIT_ASSERT_EQUAL((size_t) 1999, set.size());
+}
+
+void IHashTableTest::collisionTest() {
+    IHashSet<int, ICollisionHash> set;
+    for (int i = 0; i < 400; i++) { set.insert(i); }
+    CPPUNIT_ASSERT_EQUAL((size_t) 400, set.size());
+    for (int i = 0; i < 400; i++) { CPPUNIT_ASSERT(set.find(i) != set.end()); }
+    /*Erase from the middle of the clusters, the backward shift must keep every probe sequence reachable*/
+    for (int i = 0; i < 400; i += 3) { CPPUNIT_ASSERT_EQUAL((size_t) 1, set.erase(i)); }
+    for (int i = 0; i < 400; i++) { CPPUNIT_ASSERT_EQUAL(i % 3 != 0, set.find(i) != set.end()); }
+    for (int i = 400; i < 500; i++) { set.insert(i); }
+    for (int i = 0; i < 500; i++) { CPPUNIT_ASSERT_EQUAL(i >= 400 || i % 3 != 0, set.find(i) != set.end()); }
+}
+
+void IHashTableTest::iteratorTest() {
+    IHashSet<int> set;
+    std::set<int> expected;
+    for (int i = 0; i < 3000; i++) {
+        set.insert(i * 31 % 5000);
+        expected.insert(i * 31 % 5000);
+    }
+    for (int i = 0; i < 3000; i += 5) {
+        set.erase(i);
+        expected.erase(i);
+    }
+    std::set<int> visited;
+    size_t n = 0;
+    for (auto it = set.begin(); it != set.end(); ++it) {
+        visited.insert(*it);
+        n++;
+    }
+    CPPUNIT_ASSERT_EQUAL(set.size(), n);
+    CPPUNIT_ASSERT(expected == visited);
+}
+
+void IHashTableTest::mapTest() {
+    IHashMap<std::string, int64_t> map;
+    for (int i = 0; i < 5000; i++) { map[std::to_string(i % 100)] += i; }
+    CPPUNIT_ASSERT_EQUAL((size_t) 100, map.size());
+    for (int k = 0; k < 100; k++) {
+        int64_t expected = 0;
+        for (int i = k; i < 5000; i += 100) { expected += i; }
+        auto it = map.find(std::to_string(k));
+        CPPUNIT_ASSERT(it != map.end());
+        CPPUNIT_ASSERT_EQUAL(expected, it->second);
+    }
+    auto result = map.insert(std::make_pair(std::string("7"), (int64_t) -1));
+    CPPUNIT_ASSERT(!result.second);
+    CPPUNIT_ASSERT(result.first->second != -1);
+}
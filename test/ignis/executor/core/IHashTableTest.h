@@ -0,0 +1,43 @@
+
+#ifndef IGNIS_IHASHTABLETEST_H
+#define IGNIS_IHASHTABLETEST_H
+
+#include "ignis/executor/core/IHashTable.h"
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace ignis {
+    namespace executor {
+        namespace core {
+            class IHashTableTest : public CPPUNIT_NS::TestCase {
+                CPPUNIT_TEST_SUITE(IHashTableTest);
+                CPPUNIT_TEST(insertFindTest);
+                CPPUNIT_TEST(growthTest);
+                CPPUNIT_TEST(eraseTest);
+                CPPUNIT_TEST(collisionTest);
+                CPPUNIT_TEST(iteratorTest);
+                CPPUNIT_TEST(mapTest);
+                CPPUNIT_TEST_SUITE_END();
+
+            public:
+                void setUp() {}
+
+                void insertFindTest();
+
+                void growthTest();
+
+                void eraseTest();
+
+                void collisionTest();
+
+                void iteratorTest();
+
+                void mapTest();
+
+                void tearDown() {}
+            };
+        }// namespace core
+    }    // namespace executor
+}// namespace ignis
+
+#endif
@@ -0,0 +1,47 @@
+
+#include "IHyperLogLogTest.h"
+#include "ignis/executor/core/exception/IInvalidArgument.h"
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+
+using namespace ignis::executor::core;
+
+namespace {
+    /*Error bound of 4 standard errors, the inputs are fixed so the result is deterministic*/
+    void assertNear(int64_t expected, int64_t estimate, int bits) {
+        double error = 4 * 1.04 / std::sqrt((double) (1 << bits));
+        CPPUNIT_ASSERT(std::abs(estimate - expected) <= error * expected);
+    }
+}// namespace
+
+void IHyperLogLogTest::smallTest() {
+    IHyperLogLog hll;
+    CPPUNIT_ASSERT_EQUAL((int64_t) 0, hll.estimate());
+    /*Repeated values do not count*/
+    for (int r = 0; r < 10; r++) {
+        for (int64_t i = 0; i < 500; i++) { hll.add(std::hash<int64_t>()(i)); }
+    }
+    assertNear(500, hll.estimate(), 12);
+}
+
+void IHyperLogLogTest::largeTest() {
+    IHyperLogLog hll(14);
+    for (int64_t i = 0; i < 1000000; i++) { hll.add(std::hash<int64_t>()(i)); }
+    assertNear(1000000, hll.estimate(), 14);
+}
+
+void IHyperLogLogTest::mergeTest() {
+    IHyperLogLog a, b;
+    for (int64_t i = 0; i < 60000; i++) { a.add(std::hash<int64_t>()(i)); }
+    for (int64_t i = 40000; i < 100000; i++) { b.add(std::hash<int64_t>()(i)); }
+    a.merge(b);
+    assertNear(100000, a.estimate(), 12);
+    IHyperLogLog c(10);
+    CPPUNIT_ASSERT_THROW(a.merge(c), exception::IInvalidArgument);
+}
+
+void IHyperLogLogTest::bitsTest() {
+    CPPUNIT_ASSERT_THROW(IHyperLogLog(3), exception::IInvalidArgument);
+    CPPUNIT_ASSERT_THROW(IHyperLogLog(19), exception::IInvalidArgument);
+}
@@ -0,0 +1,37 @@
+
+#ifndef IGNIS_IHYPERLOGLOGTEST_H
+#define IGNIS_IHYPERLOGLOGTEST_H
+
+#include "ignis/executor/core/IHyperLogLog.h"
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace ignis {
+    namespace executor {
+        namespace core {
+            class IHyperLogLogTest : public CPPUNIT_NS::TestCase {
+                CPPUNIT_TEST_SUITE(IHyperLogLogTest);
+                CPPUNIT_TEST(smallTest);
+                CPPUNIT_TEST(largeTest);
+                CPPUNIT_TEST(mergeTest);
+                CPPUNIT_TEST(bitsTest);
+                CPPUNIT_TEST_SUITE_END();
+
+            public:
+                void setUp() {}
+
+                void smallTest();
+
+                void largeTest();
+
+                void mergeTest();
+
+                void bitsTest();
+
+                void tearDown() {}
+            };
+        }// namespace core
+    }    // namespace executor
+}// namespace ignis
+
+#endif
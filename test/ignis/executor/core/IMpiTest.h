@@ -22,10 +22,19 @@ namespace ignis {
                 CPPUNIT_TEST(gather1Test);
                 CPPUNIT_TEST(bcastTest);
                 CPPUNIT_TEST(sendRcvTest);
+                CPPUNIT_TEST(gatherChunkTest);
+                CPPUNIT_TEST(bcastChunkTest);
+                CPPUNIT_TEST(sendRcvChunkTest);
+                CPPUNIT_TEST(sendRcvSharedTest);
+                CPPUNIT_TEST(gatherLz4Test);
+                CPPUNIT_TEST(bcastZstdTest);
+                CPPUNIT_TEST(gatherAdaptiveTest);
+                CPPUNIT_TEST(sendRcvAdaptiveTest);
                 CPPUNIT_TEST(sendRcvGroupToMemoryTest);
                 CPPUNIT_TEST(sendRcvGroupToRawMemoryTest);
                 CPPUNIT_TEST(sendRcvGroupToDiskTest);
                 CPPUNIT_TEST(sendRcvGroupToVoidTest);
+                CPPUNIT_TEST(sendRcvGroupCachedTest);
                 CPPUNIT_TEST(driverGatherTest);
                 CPPUNIT_TEST(driverScatterTest);
                 CPPUNIT_TEST(driverScatterVoidTest);
@@ -34,6 +43,8 @@ namespace ignis {
                 CPPUNIT_TEST(asyncExchangeTest);
                 CPPUNIT_TEST(asyncExchangeCoresTest);
                 CPPUNIT_TEST(autoExchangeTest);
+                CPPUNIT_TEST(alltoallExchangeTest);
+                CPPUNIT_TEST(alltoallStagedExchangeTest);
                 CPPUNIT_TEST_SUITE_END();
 
             public:
@@ -57,6 +68,29 @@ namespace ignis {
 
                 void sendRcvGroupToVoidTest();
 
+                /*Later messages reuse the handshake until the receiver storage changes*/
+                void sendRcvGroupCachedTest() {
+                    sendRcvGroupTest("Memory");
+                    sendRcvGroupTest("Disk");
+                    sendRcvGroupTest("Memory");
+                }
+
+                void gatherChunkTest();
+
+                void bcastChunkTest();
+
+                void sendRcvChunkTest();
+
+                void sendRcvSharedTest();
+
+                void gatherLz4Test();
+
+                void bcastZstdTest();
+
+                void gatherAdaptiveTest();
+
+                void sendRcvAdaptiveTest();
+
                 void driverGatherTest();
 
                 void driverScatterTest();
@@ -73,6 +107,11 @@ namespace ignis {
 
                 void autoExchangeTest();
 
+                void alltoallExchangeTest();
+
+                /*Small staging memory, the exchange is sent in several rounds*/
+                void alltoallStagedExchangeTest();
+
                 void tearDown();
 
             private:
@@ -106,6 +106,56 @@ void IMpiTestClass<Ps>::sendRcvTest() {
     executor_data->mpi().barrier();
 }
 
+template<typename Ps>
+void IMpiTestClass<Ps>::gatherChunkTest() {
+    executor_data->getContext().props()["ignis.transport.chunk"] = "16";
+    gatherTest(0);
+}
+
+template<typename Ps>
+void IMpiTestClass<Ps>::bcastChunkTest() {
+    executor_data->getContext().props()["ignis.transport.chunk"] = "16";
+    bcastTest();
+}
+
+template<typename Ps>
+void IMpiTestClass<Ps>::sendRcvChunkTest() {
+    executor_data->getContext().props()["ignis.transport.chunk"] = "16";
+    sendRcvTest();
+}
+
+template<typename Ps>
+void IMpiTestClass<Ps>::gatherLz4Test() {
+    executor_data->getContext().props()["ignis.transport.codec"] = "lz4";
+    executor_data->getContext().props()["ignis.partition.codec"] = "lz4";
+    gatherTest(0);
+}
+
+template<typename Ps>
+void IMpiTestClass<Ps>::bcastZstdTest() {
+    executor_data->getContext().props()["ignis.transport.codec"] = "zstd";
+    executor_data->getContext().props()["ignis.partition.codec"] = "zstd-long";
+    bcastTest();
+}
+
+template<typename Ps>
+void IMpiTestClass<Ps>::gatherAdaptiveTest() {
+    executor_data->getContext().props()["ignis.transport.adaptive"] = "1";
+    gatherTest(1);
+}
+
+template<typename Ps>
+void IMpiTestClass<Ps>::sendRcvAdaptiveTest() {
+    executor_data->getContext().props()["ignis.transport.adaptive"] = "1";
+    sendRcvTest();
+}
+
+template<typename Ps>
+void IMpiTestClass<Ps>::sendRcvSharedTest() {
+    executor_data->getContext().props()["ignis.transport.shared"] = "1";
+    sendRcvTest();
+}
+
 template<typename Ps>
 void IMpiTestClass<Ps>::sendRcvGroupTest(const std::string &partitionType) {
     int n = 100;
@@ -276,6 +326,21 @@ void IMpiTestClass<Ps>::autoExchangeTest(){
     exchange();
 }
 
+template<typename Ps>
+void IMpiTestClass<Ps>::alltoallExchangeTest(){
+    executor_data->getContext().props()["ignis.modules.exchange.type"] = "alltoall";
+    executor_data->getContext().props()["ignis.transport.cores"] = "0";
+    exchange();
+}
+
+template<typename Ps>
+void IMpiTestClass<Ps>::alltoallStagedExchangeTest(){
+    executor_data->getContext().props()["ignis.modules.exchange.type"] = "alltoall";
+    executor_data->getContext().props()["ignis.modules.exchange.memory"] = "64";
+    executor_data->getContext().props()["ignis.transport.cores"] = "0";
+    exchange();
+}
+
 template<typename Ps>
 void IMpiTestClass<Ps>::exchange(){
     int n = 100;
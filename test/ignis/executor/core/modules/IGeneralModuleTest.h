@@ -25,8 +25,13 @@ namespace ignis {
                     CPPUNIT_TEST(groupByIntStringTest);
                     CPPUNIT_TEST(sortIntTest);
                     CPPUNIT_TEST(sortStringTest);
+                    CPPUNIT_TEST(radixSortIntTest);
+                    CPPUNIT_TEST(radixSortDescIntTest);
                     CPPUNIT_TEST(distinctIntTest);
                     CPPUNIT_TEST(joinStringIntTest);
+                    CPPUNIT_TEST(joinSkewStringIntTest);
+                    CPPUNIT_TEST(joinBroadcastStringIntTest);
+                    CPPUNIT_TEST(joinMergeStringIntTest);
                     CPPUNIT_TEST(unionIntTest);
                     CPPUNIT_TEST(unionUnorderedStringTest);
                     CPPUNIT_TEST(resamplingSortIntTest);
@@ -34,6 +39,8 @@ namespace ignis {
                     CPPUNIT_TEST(mapValuesIntTest);
                     CPPUNIT_TEST(groupByKeyIntStringTest);
                     CPPUNIT_TEST(reduceByKeyIntStringTest);
+                    CPPUNIT_TEST(groupByKeySpillIntStringTest);
+                    CPPUNIT_TEST(reduceByKeySpillIntStringTest);
                     CPPUNIT_TEST(aggregateByKeyIntIntTest);
                     CPPUNIT_TEST(foldByKeyIntIntTest);
                     CPPUNIT_TEST(sortByKeyIntStringTest);
@@ -82,10 +89,26 @@ namespace ignis {
 
                     void resamplingSortIntTest() { sortTest<int>("SortInt", 2, "Memory", true); }
 
+                    void radixSortIntTest() { radixSortTest<int>(2, "Memory", true); }
+
+                    void radixSortDescIntTest() { radixSortTest<int>(2, "RawMemory", false); }
+
                     void distinctIntTest() { distinctTest<int>(2, "Memory"); }
 
                     void joinStringIntTest() { joinTest<std::string, int>(2, "RawMemory"); }
 
+                    void joinSkewStringIntTest() { joinTest<std::string, int>(2, "Memory", true); }
+
+                    void joinBroadcastStringIntTest() {
+                        executor_data->getContext().props()["ignis.modules.join.type"] = "broadcast";
+                        joinTest<std::string, int>(2, "RawMemory");
+                    }
+
+                    void joinMergeStringIntTest() {
+                        executor_data->getContext().props()["ignis.modules.join.type"] = "merge";
+                        joinTest<std::string, int>(2, "Disk");
+                    }
+
                     void unionIntTest() { unionTest<int>(2, "Memory", true); }
 
                     void unionUnorderedStringTest() { unionTest<int>(2, "RawMemory", false); }
@@ -100,6 +123,16 @@ namespace ignis {
                         reduceByKeyTest<int, std::string>("ReduceString", 2, "RawMemory");
                     }
 
+                    void groupByKeySpillIntStringTest() {
+                        executor_data->getContext().props()["ignis.modules.reduce.memory"] = "1Ki";
+                        groupByKeyTest(2, "Memory");
+                    }
+
+                    void reduceByKeySpillIntStringTest() {
+                        executor_data->getContext().props()["ignis.modules.reduce.memory"] = "1Ki";
+                        reduceByKeyTest<int, std::string>("ReduceString", 2, "Memory");
+                    }
+
                     void aggregateByKeyIntIntTest() {
                         aggregateByKeyTest<int, int>("ZeroString", "ReduceIntToString", "ReduceString", 2, "Memory");
                     }
@@ -157,11 +190,14 @@ namespace ignis {
                     void sortTest(const std::string &name, int cores, const std::string &partitionType,
                                   bool resampling = false);
 
+                    template<typename Tp>
+                    void radixSortTest(int cores, const std::string &partitionType, bool ascending);
+
                     template<typename Tp>
                     void distinctTest(int cores, const std::string &partitionType);
 
                     template<typename Key, typename Value>
-                    void joinTest(int cores, const std::string &partitionType);
+                    void joinTest(int cores, const std::string &partitionType, bool skew = false);
 
                     template<typename Tp>
                     void unionTest(int cores, const std::string &partitionType, bool preserveOrder);
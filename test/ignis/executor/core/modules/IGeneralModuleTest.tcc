@@ -202,6 +202,42 @@ void IGeneralModuleTestClass::sortTest(const std::string &name, int cores, const
     }
 }
 
+template<typename Tp>
+void IGeneralModuleTestClass::radixSortTest(int cores, const std::string &partitionType, bool ascending) {
+    executor_data->getContext().props()["ignis.partition.type"] = partitionType;
+    executor_data->getContext().props()["ignis.modules.sort.resampling"] = "false";
+
+    auto np = executor_data->getContext().executors();
+    executor_data->setCores(cores);
+    auto elems = IElements<Tp>().create(10000 * cores * np, 0);
+    auto local_elems = rankVector(elems);
+    loadToPartitions(local_elems, cores);
+    registerType<Tp>();
+    general->sort(ascending);
+    auto result = getFromPartitions<Tp>();
+
+    for (int i = 1; i < result.size(); i++) {
+        if (ascending) {
+            CPPUNIT_ASSERT_GREATEREQUAL(result[i - 1], result[i]);
+        } else {
+            CPPUNIT_ASSERT_GREATEREQUAL(result[i], result[i - 1]);
+        }
+    }
+
+    loadToPartitions(result, 1);
+
+    executor_data->mpi().gather(*((*executor_data->getPartitions<Tp>())[0]), 0);
+
+    result = getFromPartitions<Tp>();
+
+    if (executor_data->mpi().isRoot(0)) {
+        CPPUNIT_ASSERT_EQUAL(elems.size(), result.size());
+        std::sort(elems.begin(), elems.end());
+        if (!ascending) { std::reverse(elems.begin(), elems.end()); }
+        for (int i = 0; i < result.size(); i++) { CPPUNIT_ASSERT_EQUAL(elems[i], result[i]); }
+    }
+}
+
 template<typename Tp>
 void IGeneralModuleTestClass::distinctTest(int cores, const std::string &partitionType) {
     executor_data->getContext().props()["ignis.partition.type"] = partitionType;
@@ -225,12 +261,20 @@ void IGeneralModuleTestClass::distinctTest(int cores, const std::string &partiti
 }
 
 template<typename Key, typename Value>
-void IGeneralModuleTestClass::joinTest(int cores, const std::string &partitionType) {
+void IGeneralModuleTestClass::joinTest(int cores, const std::string &partitionType, bool skew) {
     executor_data->getContext().props()["ignis.partition.type"] = partitionType;
     executor_data->setCores(cores);
     auto np = executor_data->getContext().executors();
     auto elems = IElements<std::pair<Key, Value>>().create(100 * cores * 2 * np, 0);
     auto elems2 = IElements<std::pair<Key, Value>>().create(100 * cores * 2 * np, 1);
+    if (skew) {
+        /*A third of the elements share the same key*/
+        executor_data->getContext().props()["ignis.modules.reduce.skew"] = "0.05";
+        for (int i = 0; i < elems.size(); i += 3) {
+            elems[i].first = elems[0].first;
+            elems2[i].first = elems[0].first;
+        }
+    }
     auto local_elems = rankVector(elems);
     auto local_elems2 = rankVector(elems2);
 
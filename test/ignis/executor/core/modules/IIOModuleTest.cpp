@@ -1,6 +1,10 @@
 
 #include "IIOModuleTest.h"
+#include "ignis/executor/core/io/IColumnReader.h"
+#include "ignis/executor/core/io/IColumnWriter.h"
+#include "ignis/executor/core/io/IRowFile.h"
 #include <fstream>
+#include <limits>
 #include <ignis/executor/api/IJsonValue.h>
 
 using namespace ignis::executor::core::modules;
@@ -14,9 +18,14 @@ IIOModuleTest::IIOModuleTest() : io(std::make_shared<IIOModule>(executor_data))
     props["ignis.modules.io.compression"] = "0";
 }
 
-void IIOModuleTest::setUp() {}
+void IIOModuleTest::setUp() { cores = executor_data->getCores(); }
 
-void IIOModuleTest::tearDown() {}
+void IIOModuleTest::tearDown() {
+    executor_data->setCores(cores);
+    executor_data->getContext().props().erase("ignis.modules.io.columnar");
+    executor_data->getContext().props().erase("ignis.modules.io.block");
+    executor_data->getContext().props().erase("ignis.modules.io.writers");
+}
 
 void IIOModuleTest::voidWithCompileTest(bool compileTest) {
     auto elems = IElements<std::string>().create(100, 0);
@@ -51,28 +60,24 @@ void IIOModuleTest::voidWithCompileTest(bool compileTest) {
     CPPUNIT_ASSERT(elems == result);
 }
 
-void IIOModuleTest::textFileTest(int n, int cores) {
-    executor_data->setCores(cores);
+std::vector<std::string> IIOModuleTest::randomLines() {
     srand(0);
     const char alphanum[] = "0123456789"
                             "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
                             "abcdefghijklmnopqrstuvwxyz";
-
-    std::string path = "./tmpfile.txt";
-    auto executors = executor_data->getContext().executors();
-    std::ofstream file(path, std::fstream::trunc);
     std::vector<std::string> lines;
     std::string line;
 
     for (int l = 0; l < 10000; l++) {
         int lc = rand() % 100;
         for (int i = 0; i < lc; ++i) { line += alphanum[rand() % (sizeof(alphanum) - 1)]; }
-        file << line << std::endl;
         lines.push_back(std::move(line));
     }
+    return lines;
+}
 
-    io->textFile2(path, n);
-
+void IIOModuleTest::checkLines(const std::vector<std::string> &lines, int n) {
+    auto executors = executor_data->getContext().executors();
     CPPUNIT_ASSERT_GREATEREQUAL(n / executors, (int) executor_data->getPartitions<std::string>()->partitions());
 
     auto result = getFromPartitions<std::string>();
@@ -89,28 +94,30 @@ void IIOModuleTest::textFileTest(int n, int cores) {
     }
 }
 
-void IIOModuleTest::plainFileTest(int n, int cores, const std::string &delim, const std::string& ex) {
+void IIOModuleTest::textFileTest(int n, int cores) {
     executor_data->setCores(cores);
-    srand(0);
-    const char alphanum[] = "0123456789"
-                            "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-                            "abcdefghijklmnopqrstuvwxyz";
+    std::string path = "./tmpfile.txt";
+    std::ofstream file(path, std::fstream::trunc);
+    auto lines = randomLines();
+    for (auto &line : lines) { file << line << std::endl; }
+
+    io->textFile2(path, n);
+
+    checkLines(lines, n);
+}
 
+void IIOModuleTest::plainFileTest(int n, int cores, const std::string &delim, const std::string& ex) {
+    executor_data->setCores(cores);
     std::string path = "./plainfile.txt";
-    auto executors = executor_data->getContext().executors();
     std::ofstream file(path, std::fstream::trunc);
-    std::vector<std::string> lines;
-    std::string line;
+    auto lines = randomLines();
     std::string delim2 = delim;
 
-    for (int l = 0; l < 10000; l++) {
-        int lc = rand() % 100;
-        for (int i = 0; i < lc; ++i) { line += alphanum[rand() % (sizeof(alphanum) - 1)]; }
+    for (auto &line : lines) {
         if(!ex.empty()){
             line += ex + delim;
         }
         file << line << delim;
-        lines.push_back(std::move(line));
     }
     file.flush();
 
@@ -130,20 +137,49 @@ void IIOModuleTest::plainFileTest(int n, int cores, const std::string &delim, co
 
     io->plainFile3(path, n, delim2);
 
-    CPPUNIT_ASSERT_GREATEREQUAL(n / executors, (int) executor_data->getPartitions<std::string>()->partitions());
+    checkLines(lines, n);
+}
 
-    auto result = getFromPartitions<std::string>();
+void IIOModuleTest::jsonLinesFileTest(int n, int cores) {
+    executor_data->setCores(cores);
+    std::string path = "./tmpfile.jsonl";
+    std::ofstream file(path, std::fstream::trunc);
+    auto lines = randomLines();
 
-    loadToPartitions(result, 1);
+    for (size_t l = 0; l < lines.size(); l++) {
+        /*Blank lines are not elements*/
+        if (l % 10 == 0) { file << std::endl; }
+        file << " \"" << lines[l] << "\" " << std::endl;
+    }
+    file.flush();
 
-    executor_data->mpi().gather(*((*executor_data->getPartitions<std::string>())[0]), 0);
+    impl::IIOImpl io_impl(executor_data);
+    io_impl.jsonLinesFile<std::string>(path, n);
 
-    result = getFromPartitions<std::string>();
+    checkLines(lines, n);
+}
 
-    if (executor_data->mpi().isRoot(0)) {
-        CPPUNIT_ASSERT_EQUAL(lines.size(), result.size());
-        for (int i = 0; i < result.size(); i++) { CPPUNIT_ASSERT_EQUAL(lines[i], result[i]); }
+void IIOModuleTest::jsonLinesArrayTest() {
+    int n = 8;
+    executor_data->setCores(2);
+    std::string path = "./tmpfile.jsonl";
+    std::ofstream file(path, std::fstream::trunc);
+    auto lines = randomLines();
+    /*Records that are arrays must not be taken for the array of a json document*/
+    for (auto &line : lines) { file << "[\"" << line << "\", \"" << line << "\"]" << std::endl; }
+    file.flush();
+
+    impl::IIOImpl io_impl(executor_data);
+    io_impl.jsonLinesFile<std::vector<std::string>>(path, n);
+
+    api::IVector<std::string> result;
+    for (auto &record : getFromPartitions<std::vector<std::string>>()) {
+        CPPUNIT_ASSERT_EQUAL((size_t) 2, record.size());
+        CPPUNIT_ASSERT_EQUAL(record[0], record[1]);
+        result.push_back(record[0]);
     }
+    loadToPartitions(result, 1);
+    checkLines(lines, executor_data->getContext().executors());
 }
 
 void IIOModuleTest::saveAsTextFileTest(int n, int cores) {
@@ -170,10 +206,12 @@ void IIOModuleTest::saveAsTextFileTest(int n, int cores) {
 }
 
 
-void IIOModuleTest::partitionTextFileTest() {
+void IIOModuleTest::partitionTextFileTestImpl(int writers) {
     std::string path = "./savetest.txt";
     int n = 8;
     auto rank = executor_data->mpi().rank();
+    auto &props = executor_data->getContext().props();
+    props["ignis.modules.io.writers"] = std::to_string(writers);
     srand(0);
     const char alphanum[] = "0123456789"
                             "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
@@ -191,6 +229,7 @@ void IIOModuleTest::partitionTextFileTest() {
     loadToPartitions(lines, n);
     if (ghc::filesystem::exists(path)) { ghc::filesystem::remove_all(path); }
     io->saveAsTextFile(path, rank * n);
+    props.erase("ignis.modules.io.writers");
     io->partitionTextFile(path, rank * n, n);
 
     auto result = getFromPartitions<std::string>();
@@ -230,10 +269,12 @@ void IIOModuleTest::partitionJsonFileTestImpl(bool objMap) {
     }
 }
 
-void IIOModuleTest::partitionObjectFileTest() {
+void IIOModuleTest::partitionObjectFileTestImpl(int writers) {
     std::string path = "./savetest.txt";
     int n = 8;
     auto rank = executor_data->mpi().rank();
+    auto &props = executor_data->getContext().props();
+    props["ignis.modules.io.writers"] = std::to_string(writers);
     srand(0);
     const char alphanum[] = "0123456789"
                             "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
@@ -251,8 +292,144 @@ void IIOModuleTest::partitionObjectFileTest() {
     loadToPartitions(lines, n);
     if (ghc::filesystem::exists(path)) { ghc::filesystem::remove_all(path); }
     io->saveAsObjectFile(path, 0, rank * n);
+    props.erase("ignis.modules.io.writers");
     io->partitionObjectFile(path, rank * n, n);
 
     auto result = getFromPartitions<std::string>();
     CPPUNIT_ASSERT(lines == result);
-}
\ No newline at end of file
+}
+
+void IIOModuleTest::partitionObjectFileBlocksTest() {
+    std::string path = "./savetest.txt";
+    int n = 2;
+    auto rank = executor_data->mpi().rank();
+    auto &props = executor_data->getContext().props();
+    props["ignis.modules.io.block"] = "1KB";
+    executor_data->setCores(3);
+    srand(0);
+    api::IVector<std::string> lines;
+    for (int l = 0; l < 10000; l++) { lines.push_back(std::to_string(rand())); }
+
+    loadToPartitions(lines, n);
+    if (ghc::filesystem::exists(path)) { ghc::filesystem::remove_all(path); }
+    impl::IIOImpl io_impl(executor_data);
+    io_impl.saveAsObjectFile<std::string>(path, 6, rank * n);
+    CPPUNIT_ASSERT(io::IRowFile::readIndex(io_impl.partitionFileName(path, rank * n)).size() > 1);
+    /*The second thread reads the end of the first file and the beginning of the second one*/
+    io_impl.partitionObjectFile<std::string>(path, rank * n, n);
+
+    auto result = getFromPartitions<std::string>();
+    CPPUNIT_ASSERT(lines == result);
+}
+
+void IIOModuleTest::partitionColumnarFileTest() {
+    typedef std::pair<int64_t, std::string> Tp;
+    std::string path = "./savetest.txt";
+    int n = 8;
+    auto rank = executor_data->mpi().rank();
+    auto &props = executor_data->getContext().props();
+    props["ignis.modules.io.columnar"] = "1000";
+    srand(0);
+    const char alphanum[] = "0123456789"
+                            "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                            "abcdefghijklmnopqrstuvwxyz";
+    api::IVector<Tp> elems;
+    std::string value;
+
+    for (int l = 0; l < 10000; l++) {
+        int lc = rand() % 3;
+        for (int i = 0; i < lc; ++i) { value += alphanum[rand() % (sizeof(alphanum) - 1)]; }
+        elems.emplace_back(l, std::move(value));
+    }
+
+    loadToPartitions(elems, n);
+    if (ghc::filesystem::exists(path)) { ghc::filesystem::remove_all(path); }
+    impl::IIOImpl io_impl(executor_data);
+    io_impl.saveAsObjectFile<Tp>(path, 6, rank * n);
+    io_impl.partitionObjectFile<Tp>(path, rank * n, n);
+
+    auto result = getFromPartitions<Tp>();
+    CPPUNIT_ASSERT(elems == result);
+
+    /*Partitions have 1250 elements, only the group of keys 2500-3499 can have keys in the range*/
+    io_impl.partitionColumnFile<Tp, std::string, int64_t>(path, rank * n, n, 1, 0, 2600, 3100);
+    auto values = getFromPartitions<std::string>();
+    CPPUNIT_ASSERT_EQUAL((size_t) 1000, values.size());
+    for (int i = 0; i < values.size(); i++) { CPPUNIT_ASSERT_EQUAL(elems[2500 + i].second, values[i]); }
+}
+
+void IIOModuleTest::objectFileTest() {
+    std::string path = "./savetest.txt";
+    int n = 2;
+    auto rank = executor_data->mpi().rank();
+    auto executors = executor_data->getContext().executors();
+    auto &props = executor_data->getContext().props();
+    props["ignis.modules.io.columnar"] = "100";
+    executor_data->setCores(2);
+    srand(0);
+    api::IVector<int64_t> elems;
+    for (int i = 0; i < 10000; i++) { elems.push_back(rand() % 1000); }
+
+    loadToPartitions(elems, n);
+    if (ghc::filesystem::exists(path)) { ghc::filesystem::remove_all(path); }
+    executor_data->mpi().barrier();
+    impl::IIOImpl io_impl(executor_data);
+    io_impl.saveAsObjectFile<int64_t>(path, 0, rank * n);
+    executor_data->mpi().barrier();
+    /*Files written by every executor are split again in row groups*/
+    io_impl.objectFile<int64_t>(path, executors * n, 8);
+
+    auto result = getFromPartitions<int64_t>();
+    loadToPartitions(result, 1);
+    executor_data->mpi().gather(*((*executor_data->getPartitions<int64_t>())[0]), 0);
+    result = getFromPartitions<int64_t>();
+
+    if (executor_data->mpi().isRoot(0)) {
+        CPPUNIT_ASSERT_EQUAL(elems.size() * executors, result.size());
+        for (int i = 0; i < result.size(); i++) { CPPUNIT_ASSERT_EQUAL(elems[i % elems.size()], result[i]); }
+    }
+}
+
+void IIOModuleTest::columnEncodingTest() {
+    std::string path = "./columntest.icol";
+    srand(0);
+    api::IVector<int64_t> elems;
+    for (int i = 0; i < 1000; i++) { elems.push_back(i / 100 - 5); }
+    for (int i = 0; i < 1000; i++) { elems.push_back(rand() % 1001 - 500); }
+    elems.push_back(std::numeric_limits<int64_t>::min());
+    elems.push_back(std::numeric_limits<int64_t>::max());
+
+    io::IColumnWriter<int64_t> writer(path, 6, 1000);
+    for (auto &elem : elems) { writer.write(elem); }
+    writer.close();
+
+    io::IColumnFileReader file(path);
+    CPPUNIT_ASSERT_EQUAL((int64_t) 3, file.groups());
+    /*The last group has two runs of the extreme values, 64 bits each if packed*/
+    int8_t encodings[] = {io::IColumnFile::RLE, io::IColumnFile::BIT_PACKED, io::IColumnFile::RLE};
+    for (int64_t g = 0; g < file.groups(); g++) {
+        int8_t encoding;
+        file.chunk(g, 0).readByte(encoding);
+        CPPUNIT_ASSERT_EQUAL((int) encodings[g], (int) encoding);
+    }
+
+    auto part = executor_data->getPartitionTools().newMemoryPartition<int64_t>();
+    io::IColumnReader<int64_t>(path).read(*part->writeIterator());
+    CPPUNIT_ASSERT(elems == part->inner());
+}
+
+void IIOModuleTest::columnKindTest() {
+    std::string path = "./columntest.icol";
+    io::IColumnWriter<float> writer(path, 6, 1000);
+    for (int i = 0; i < 100; i++) { writer.write(i / 2.0f); }
+    writer.close();
+
+    auto part = executor_data->getPartitionTools().newMemoryPartition<double>();
+    io::IColumnReader<double> reader(path);
+    CPPUNIT_ASSERT_THROW(reader.read(*part->writeIterator()), exception::IInvalidArgument);
+
+    auto fpart = executor_data->getPartitionTools().newMemoryPartition<float>();
+    io::IColumnReader<float>(path).read(*fpart->writeIterator());
+    CPPUNIT_ASSERT_EQUAL((size_t) 100, fpart->size());
+    CPPUNIT_ASSERT_EQUAL(49.5f, (*fpart)[99]);
+}
@@ -20,11 +20,23 @@ namespace ignis {
                     CPPUNIT_TEST(plainFileSNTest);
                     CPPUNIT_TEST(plainFileSE1Test);
                     CPPUNIT_TEST(plainFileSENTest);
+                    CPPUNIT_TEST(plainFileE1Test);
+                    CPPUNIT_TEST(plainFileENTest);
+                    CPPUNIT_TEST(jsonLinesFile1Test);
+                    CPPUNIT_TEST(jsonLinesFileNTest);
+                    CPPUNIT_TEST(jsonLinesArrayTest);
                     CPPUNIT_TEST(saveAsTextFileTest);
                     CPPUNIT_TEST(partitionTextFileTest);
+                    CPPUNIT_TEST(partitionTextFileWriteBehindTest);
                     CPPUNIT_TEST(partitionJsonFileTest);
                     CPPUNIT_TEST(partitionJsonFileMapTest);
                     CPPUNIT_TEST(partitionObjectFileTest);
+                    CPPUNIT_TEST(partitionObjectFileWriteBehindTest);
+                    CPPUNIT_TEST(partitionObjectFileBlocksTest);
+                    CPPUNIT_TEST(partitionColumnarFileTest);
+                    CPPUNIT_TEST(objectFileTest);
+                    CPPUNIT_TEST(columnEncodingTest);
+                    CPPUNIT_TEST(columnKindTest);
                     CPPUNIT_TEST_SUITE_END();
 
                 public:
@@ -52,28 +64,67 @@ namespace ignis {
 
                     void plainFileSENTest() { plainFileTest(8, 2, "@@", "!"); }
 
+                    void plainFileE1Test() { plainFileTest(1, 1, "@", "!"); }
+
+                    void plainFileENTest() { plainFileTest(8, 2, "@", "!"); }
+
+                    void jsonLinesFile1Test() { jsonLinesFileTest(1, 1); }
+
+                    void jsonLinesFileNTest() { jsonLinesFileTest(8, 2); }
+
+                    void jsonLinesArrayTest();
+
                     void saveAsTextFileTest() { saveAsTextFileTest(8, 2); }
 
-                    void partitionTextFileTest();
+                    void partitionTextFileTest() { partitionTextFileTestImpl(0); }
+
+                    void partitionTextFileWriteBehindTest() { partitionTextFileTestImpl(2); }
 
                     void partitionJsonFileTest(){partitionJsonFileTestImpl(false);}
 
                     void partitionJsonFileMapTest(){partitionJsonFileTestImpl(true);}
 
-                    void partitionObjectFileTest();
+                    void partitionObjectFileTest() { partitionObjectFileTestImpl(0); }
+
+                    void partitionObjectFileWriteBehindTest() { partitionObjectFileTestImpl(2); }
+
+                    void partitionObjectFileBlocksTest();
+
+                    void partitionColumnarFileTest();
+
+                    void objectFileTest();
+
+                    /*Groups of runs are RLE encoded and the others bit packed*/
+                    void columnEncodingTest();
+
+                    /*Float columns are not read as doubles*/
+                    void columnKindTest();
 
                 private:
                     void voidWithCompileTest(bool compileTest);
 
+                    /*Same random lines in every call*/
+                    std::vector<std::string> randomLines();
+
+                    /*Compares the partitions read by n tasks with lines in the first executor*/
+                    void checkLines(const std::vector<std::string> &lines, int n);
+
                     void textFileTest(int n, int cores);
 
                     void plainFileTest(int n, int cores, const std::string& delim, const std::string &ex ="");
 
+                    void jsonLinesFileTest(int n, int cores);
+
                     void saveAsTextFileTest(int n, int cores);
 
+                    void partitionTextFileTestImpl(int writers);
+
                     void partitionJsonFileTestImpl(bool objMap);
 
+                    void partitionObjectFileTestImpl(int writers);
+
                     std::shared_ptr<IIOModule> io;
+                    int cores;
                 };
             }// namespace modules
         }    // namespace core
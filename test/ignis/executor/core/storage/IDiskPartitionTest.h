@@ -4,17 +4,21 @@
 
 #include "IPartitionTest.h"
 #include "ignis/executor/core/storage/IDiskPartition.h"
+#include "ignis/executor/core/transport/ICodec.h"
+#include "ignis/executor/core/transport/IMappedBuffer.h"
 
 namespace ignis {
     namespace executor {
         namespace core {
             namespace storage {
 
-                template<typename Tp>
+                template<typename Tp, int16_t Codec = transport::ICodec::ZLIB>
                 class IDiskPartitionTest : public IPartitionTest<Tp> {
-                    CPPUNIT_TEST_SUITE(IDiskPartitionTest<Tp>);
+                    CPPUNIT_TEST_SUITE(IDiskPartitionTest);
                     CPPUNIT_TEST(itWriteItReadTest);
                     CPPUNIT_TEST(itWriteTransReadTest);
+                    CPPUNIT_TEST(itReadSharedTest);
+                    CPPUNIT_TEST(batchWriteBatchReadTest);
                     CPPUNIT_TEST(transWriteItReadTest);
                     CPPUNIT_TEST(transWriteTransReadTest);
                     CPPUNIT_TEST(clearTest);
@@ -24,6 +28,9 @@ namespace ignis {
                     CPPUNIT_TEST(moveTest);
                     CPPUNIT_TEST(renameTest);
                     CPPUNIT_TEST(persistTest);
+                    CPPUNIT_TEST(uncompressedCopyTest);
+                    CPPUNIT_TEST(mappedReadTest);
+                    CPPUNIT_TEST(mappedClearTest);
                     CPPUNIT_TEST_SUITE_END();
 
                 public:
@@ -31,12 +38,21 @@ namespace ignis {
 
                     virtual void persistTest();
 
+                    virtual void uncompressedCopyTest();
+
+                    virtual void mappedReadTest();
+
+                    /*A reader mapping the file is still valid after the partition is cleared*/
+                    virtual void mappedClearTest();
+
                 private:
                     virtual std::shared_ptr<IPartition<Tp>> create() {
                         std::string path = "./diskpartitionTest" + std::to_string(file++);
-                        return std::make_shared<IDiskPartition<Tp>>(path);
+                        return std::make_shared<IDiskPartition<Tp>>(path, compression());
                     }
 
+                    int8_t compression() { return transport::ICodec::compression(Codec, 6); }
+
                     int file = 0;
                 };
 
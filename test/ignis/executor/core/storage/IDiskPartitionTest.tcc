@@ -3,11 +3,11 @@
 
 #define IDiskPartitionTestClass ignis::executor::core::storage::IDiskPartitionTest
 
-template<typename Tp>
-void IDiskPartitionTestClass<Tp>::renameTest() {
+template<typename Tp, int16_t Codec>
+void IDiskPartitionTestClass<Tp, Codec>::renameTest() {
     std::string path = "./diskpartitionTest";
     std::string newPath = "./diskpartitionTestRename";
-    auto part = std::make_shared<IDiskPartition<Tp>>(path);
+    auto part = std::make_shared<IDiskPartition<Tp>>(path, compression());
     IVector<Tp> elems = IElements<Tp>::create(100, 0);
     this->writeIterator(elems, *part);
     part->rename(newPath);
@@ -18,19 +18,79 @@ void IDiskPartitionTestClass<Tp>::renameTest() {
     CPPUNIT_ASSERT(elems == result);
 }
 
-template<typename Tp>
-void IDiskPartitionTestClass<Tp>::persistTest() {
+template<typename Tp, int16_t Codec>
+void IDiskPartitionTestClass<Tp, Codec>::persistTest() {
     std::string path = "./diskpartitionTest";
-    auto part = std::make_shared<IDiskPartition<Tp>>(path, 6, true, false);
+    auto part = std::make_shared<IDiskPartition<Tp>>(path, compression(), true, false);
     IVector<Tp> elems = IElements<Tp>::create(100, 0);
     this->writeIterator(elems, *part);
     part->persist(true);
     part->sync();
-    part = std::make_shared<IDiskPartition<Tp>>(path, 6, false, true);
+    part = std::make_shared<IDiskPartition<Tp>>(path, compression(), false, true);
     CPPUNIT_ASSERT_EQUAL(elems.size(), part->size());
     IVector<Tp> result;
     this->readIterator(*part, result);
     CPPUNIT_ASSERT(elems == result);
 }
 
+template<typename Tp, int16_t Codec>
+void IDiskPartitionTestClass<Tp, Codec>::uncompressedCopyTest() {
+    auto part = std::make_shared<IDiskPartition<Tp>>("./diskpartitionTestCopy0", 0);
+    auto part2 = std::make_shared<IDiskPartition<Tp>>("./diskpartitionTestCopy1", 0);
+    auto part3 = create();
+    IVector<Tp> elems = IElements<Tp>::create(100, 0);
+    IVector<Tp> elems2 = IElements<Tp>::create(100, 1);
+    IVector<Tp> elems3 = IElements<Tp>::create(100, 2);
+    this->writeIterator(elems, *part);
+    this->writeIterator(elems2, *part2);
+    this->writeIterator(elems3, *part3);
+    part2->copyTo(*part);
+    part3->copyTo(*part);
+    elems.insert(elems.end(), elems2.begin(), elems2.end());
+    elems.insert(elems.end(), elems3.begin(), elems3.end());
+    CPPUNIT_ASSERT_EQUAL(elems.size(), part->size());
+    IVector<Tp> result;
+    this->readIterator(*part, result);
+    CPPUNIT_ASSERT(elems == result);
+}
+
+template<typename Tp, int16_t Codec>
+void IDiskPartitionTestClass<Tp, Codec>::mappedReadTest() {
+    transport::IMappedBuffer::setMinSize(1);
+    for (int8_t cmp : {(int8_t) 0, compression()}) {
+        auto part = std::make_shared<IDiskPartition<Tp>>("./diskpartitionTestMapped", cmp);
+        IVector<Tp> elems = IElements<Tp>::create(100, 0);
+        this->writeIterator(elems, *part);
+        IVector<Tp> result;
+        this->readIterator(*part, result);
+        auto part2 = part->clone();
+        part2->copyTo(*part);
+        elems.insert(elems.end(), result.begin(), result.end());
+        result.clear();
+        this->readIterator(*part, result);
+        CPPUNIT_ASSERT(elems == result);
+    }
+    transport::IMappedBuffer::setMinSize(0);
+}
+
+template<typename Tp, int16_t Codec>
+void IDiskPartitionTestClass<Tp, Codec>::mappedClearTest() {
+    transport::IMappedBuffer::setMinSize(1);
+    auto part = std::make_shared<IDiskPartition<Tp>>("./diskpartitionTestMappedClear", compression());
+    IVector<Tp> elems = IElements<Tp>::create(100, 0);
+    this->writeIterator(elems, *part);
+    auto reader = part->readIterator();
+    part->clear();
+    IVector<Tp> elems2 = IElements<Tp>::create(50, 1);
+    this->writeIterator(elems2, *part);
+    IVector<Tp> result;
+    /*The partition size changed, the old elements are read without hasNext*/
+    for (size_t i = 0; i < elems.size(); i++) { result.push_back(reader->next()); }
+    CPPUNIT_ASSERT(elems == result);
+    result.clear();
+    this->readIterator(*part, result);
+    CPPUNIT_ASSERT(elems2 == result);
+    transport::IMappedBuffer::setMinSize(0);
+}
+
 #undef IDiskPartitionTestClass
\ No newline at end of file
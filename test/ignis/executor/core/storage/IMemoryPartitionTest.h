@@ -15,6 +15,8 @@ namespace ignis {
                     CPPUNIT_TEST_SUITE(IMemoryPartitionTest<Tp>);
                     CPPUNIT_TEST(itWriteItReadTest);
                     CPPUNIT_TEST(itWriteTransReadTest);
+                    CPPUNIT_TEST(itReadSharedTest);
+                    CPPUNIT_TEST(batchWriteBatchReadTest);
                     CPPUNIT_TEST(transWriteItReadTest);
                     CPPUNIT_TEST(transWriteTransReadTest);
                     CPPUNIT_TEST(clearTest);
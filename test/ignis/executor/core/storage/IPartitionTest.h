@@ -22,6 +22,10 @@ namespace ignis {
 
                     void itWriteTransReadTest();
 
+                    void itReadSharedTest();
+
+                    void batchWriteBatchReadTest();
+
                     void transWriteItReadTest();
 
                     void transWriteTransReadTest();
@@ -52,6 +52,42 @@ void IPartitionTestClass<Tp>::itWriteItReadTest() {
     CPPUNIT_ASSERT(elems == result);
 }
 
+template<typename Tp>
+void IPartitionTestClass<Tp>::itReadSharedTest() {
+    auto part = create();
+    IVector<Tp> elems = IElements<Tp>::create(100, 0);
+    writeIterator(elems, *part);
+    std::vector<std::shared_ptr<Tp>> shared;
+    IVector<Tp> result;
+    auto it = part->readIterator();
+    while (it->hasNext()) {
+        shared.push_back(it->nextShared());
+        if (it->hasNext()) { result.push_back(it->next()); }
+    }
+    for (int64_t i = 0; i < elems.size(); i++) {
+        if (i % 2 == 0) {
+            CPPUNIT_ASSERT(elems[i] == *shared[i / 2]);
+        } else {
+            CPPUNIT_ASSERT(elems[i] == result[i / 2]);
+        }
+    }
+}
+
+template<typename Tp>
+void IPartitionTestClass<Tp>::batchWriteBatchReadTest() {
+    auto part = create();
+    IVector<Tp> elems = IElements<Tp>::create(100, 0);
+    part->writeIterator()->writeBatch(reinterpret_cast<Tp *>(&elems[0]), elems.size());
+    CPPUNIT_ASSERT_EQUAL(elems.size(), part->size());
+    IVector<Tp> result(elems.size() + 10);
+    auto it = part->readIterator();
+    auto read = it->readBatch(reinterpret_cast<Tp *>(&result[0]), 30);
+    read += it->readBatch(reinterpret_cast<Tp *>(&result[read]), result.size() - read);
+    CPPUNIT_ASSERT_EQUAL((int64_t) elems.size(), read);
+    CPPUNIT_ASSERT(!it->hasNext());
+    result.resize(read);
+    CPPUNIT_ASSERT(elems == result);
+}
 
 template<typename Tp>
 void IPartitionTestClass<Tp>::itWriteTransReadTest() {
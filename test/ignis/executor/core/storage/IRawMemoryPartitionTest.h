@@ -4,17 +4,20 @@
 
 #include "IPartitionTest.h"
 #include "ignis/executor/core/storage/IRawMemoryPartition.h"
+#include "ignis/executor/core/transport/ICodec.h"
 
 namespace ignis {
     namespace executor {
         namespace core {
             namespace storage {
 
-                template<typename Tp>
+                template<typename Tp, int16_t Codec = transport::ICodec::ZLIB>
                 class IRawMemoryPartitionTest : public IPartitionTest<Tp> {
-                    CPPUNIT_TEST_SUITE(IRawMemoryPartitionTest<Tp>);
+                    CPPUNIT_TEST_SUITE(IRawMemoryPartitionTest);
                     CPPUNIT_TEST(itWriteItReadTest);
                     CPPUNIT_TEST(itWriteTransReadTest);
+                    CPPUNIT_TEST(itReadSharedTest);
+                    CPPUNIT_TEST(batchWriteBatchReadTest);
                     CPPUNIT_TEST(transWriteItReadTest);
                     CPPUNIT_TEST(transWriteTransReadTest);
                     CPPUNIT_TEST(clearTest);
@@ -25,7 +28,8 @@ namespace ignis {
                     CPPUNIT_TEST_SUITE_END();
 
                     virtual std::shared_ptr<IPartition<Tp>> create() {
-                        return std::make_shared<IRawMemoryPartition<Tp>>();
+                        return std::make_shared<IRawMemoryPartition<Tp>>(1024 * 1024,
+                                                                         transport::ICodec::compression(Codec, 6));
                     }
                 };
             }// namespace storage
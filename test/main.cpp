@@ -9,6 +9,8 @@
 #include <cppunit/ui/text/TestRunner.h>
 #include <mpi.h>
 
+#include "ignis/executor/core/IHashTableTest.h"
+#include "ignis/executor/core/IHyperLogLogTest.h"
 #include "ignis/executor/core/IMpiTest.h"
 #include "ignis/executor/core/storage/IDiskPartitionTest.h"
 #include "ignis/executor/core/storage/IMemoryPartitionTest.h"
@@ -21,6 +23,7 @@
 #include "ignis/executor/core/modules/ICommModuleTest.h"
 
 
+#define CORE_TEST "core_test"
 #define MPI_TEST "mpi_test"
 #define PARTITION_TEST "partition_test"
 #define MODULE_TEST "module_test"
@@ -28,16 +31,27 @@
 using namespace ignis::executor::core;
 
 typedef std::pair<int, std::string> PairIntString;
+typedef storage::IRawMemoryPartitionTest<PairIntString, transport::ICodec::LZ4> IRawMemoryLz4PartitionTest;
+typedef storage::IRawMemoryPartitionTest<std::string, transport::ICodec::ZSTD> IRawMemoryZstdPartitionTest;
+typedef storage::IDiskPartitionTest<int, transport::ICodec::LZ4> IDiskLz4PartitionTest;
+typedef storage::IDiskPartitionTest<PairIntString, transport::ICodec::ZSTD_LONG> IDiskZstdLongPartitionTest;
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(IHashTableTest, CORE_TEST);
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(IHyperLogLogTest, CORE_TEST);
 CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(storage::IMemoryPartitionTest<bool>, PARTITION_TEST);
 CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(storage::IMemoryPartitionTest<int>, PARTITION_TEST);
 CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(storage::IRawMemoryPartitionTest<int>, PARTITION_TEST);
 CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(storage::IRawMemoryPartitionTest<std::string>, PARTITION_TEST);
 CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(storage::IRawMemoryPartitionTest<uint8_t>, PARTITION_TEST);
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(storage::IRawMemoryPartitionTest<double>, PARTITION_TEST);
 CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(storage::IRawMemoryPartitionTest<PairIntString>, PARTITION_TEST);
 CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(storage::IDiskPartitionTest<int>, PARTITION_TEST);
 CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(storage::IDiskPartitionTest<std::string>, PARTITION_TEST);
 CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(storage::IDiskPartitionTest<uint8_t>, PARTITION_TEST);
 CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(storage::IDiskPartitionTest<PairIntString>, PARTITION_TEST);
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(IRawMemoryLz4PartitionTest, PARTITION_TEST);
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(IRawMemoryZstdPartitionTest, PARTITION_TEST);
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(IDiskLz4PartitionTest, PARTITION_TEST);
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(IDiskZstdLongPartitionTest, PARTITION_TEST);
 
 CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(IMpiTest<storage::IMemoryPartition<int>>, MPI_TEST);
 CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(IMpiTest<storage::IMemoryPartition<std::string>>, MPI_TEST);
@@ -77,6 +91,7 @@ int main(int argc, char *argv[]) {
 
     results.addListener(&result_collector);
     results.addListener(&progress);
+    runner.addTest(CPPUNIT_NS::TestFactoryRegistry::getRegistry(CORE_TEST).makeTest());
     runner.addTest(CPPUNIT_NS::TestFactoryRegistry::getRegistry(PARTITION_TEST).makeTest());
     if (parallel) { runner.addTest(CPPUNIT_NS::TestFactoryRegistry::getRegistry(MPI_TEST).makeTest()); }
     runner.addTest(CPPUNIT_NS::TestFactoryRegistry::getRegistry(MODULE_TEST).makeTest());